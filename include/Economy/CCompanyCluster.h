@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Economy/SClusterConfig.h"
+#include "Economy/SCompanyAttributes.h"
+#include "Economy/SCompanyState.h"
+#include "Economy/SCompanyAggregates.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SMacroState.h"
+#include "Economy/SSimulationTick.h"
+#include "Economy/CCompanyKernels.h"
+#include <cstdint>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+class CStateHash;
+
+// Mean and variance of one quantity across the firms of a cluster
+struct SClusterMoment
+{
+    float m_Mean;
+    float m_Variance;
+
+    SClusterMoment()
+        : m_Mean(0.0f)
+        , m_Variance(0.0f)
+    {
+    }
+
+    SClusterMoment(float mean, float variance)
+        : m_Mean(mean)
+        , m_Variance(variance)
+    {
+    }
+};
+
+// Tier-1 aggregate of many similar micro-firms (design doc 4.1).
+// Instead of one row per firm, the cluster tracks the distribution of
+// employees, liquidity, profitability and formality and simulates it with
+// the same revenue/cost kernel as individual companies. Firms enter and
+// exit stochastically. Cost per tick is independent of the population.
+class CCompanyCluster
+{
+public:
+    // Gauss-Hermite points used to evaluate the kernel over the distribution
+    static constexpr int32_t REPRESENTATIVE_COUNT = 3;
+
+private:
+    uint32_t m_ID;
+    uint16_t m_Region;              // Leaf region
+    SCompanyAttributes m_Attributes;
+    SCompanyState m_EntrantState;   // Starting state of newly created firms
+
+    int64_t m_Population;
+    int64_t m_LastEntries;
+    int64_t m_LastExits;
+
+    // Cross-sectional distribution
+    SClusterMoment m_Employees;
+    SClusterMoment m_Liquidity;
+    SClusterMoment m_Profitability;
+    SClusterMoment m_Formality;
+
+    // Shared means (drift like the individual decision rules, on average)
+    float m_Revenue;
+    float m_Debt;
+    float m_WageLevel;
+    float m_CapacityUtilization;
+    float m_AverageProfit;          // Smoothed profit, as in CCompanyStore
+
+    void UpdateFinancials(const SFinancialCoefficients& coefficients);
+    void MakeDecisions(const SPolicyParams& policy, const SMacroState& macro, float expectationSmoothing);
+
+public:
+    CCompanyCluster(uint32_t id, uint16_t region, const SClusterConfig& config, const SCompanyAttributes& attributes);
+    ~CCompanyCluster() = default;
+
+    // Simulate one month for the whole cluster, up to entry and exit
+    void Simulate(const SFinancialCoefficients& coefficients, const SPolicyParams& policy,
+                  const SMacroState& macro, float expectationSmoothing);
+
+    // Month-end entry and exit. Firms leave at GetExitRate; GetEntryRate
+    // compares the cluster's profit margin with 'referenceMargin' (the
+    // economy's), and the caller scales it so a region's clusters replace
+    // their exits in total (see CFirmDynamics::GetEntryRate).
+    float GetExitRate() const;
+    float GetEntryRate(const SMacroState& macro, float referenceMargin) const;
+    void UpdatePopulation(float entryRate, const SSimulationTick& tick);
+
+    // Add this cluster's totals to the macro aggregates
+    void Accumulate(SCompanyAggregates& aggregates) const;
+
+    // Take in 'firms' firms in the given state (level-of-detail demotion).
+    // The firm count is rounded to whole firms.
+    void Absorb(const SCompanyState& state, double firms);
+
+    // Save file section, written field by field (the members have padding)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+
+    // Add the evolving members to a state hash
+    void HashState(CStateHash& hash) const;
+
+    // Accessors
+    uint32_t GetID() const { return m_ID; }
+    uint16_t GetRegion() const { return m_Region; }
+    ESector GetSector() const { return m_Attributes.m_Sector; }
+    ECompanySize GetSize() const { return m_Attributes.m_Size; }
+    const SCompanyAttributes& GetAttributes() const { return m_Attributes; }
+    int64_t GetPopulation() const { return m_Population; }
+    int64_t GetLastEntries() const { return m_LastEntries; }
+    int64_t GetLastExits() const { return m_LastExits; }
+    const SClusterMoment& GetEmployees() const { return m_Employees; }
+    const SClusterMoment& GetLiquidity() const { return m_Liquidity; }
+    const SClusterMoment& GetProfitability() const { return m_Profitability; }
+    const SClusterMoment& GetFormality() const { return m_Formality; }
+    float GetRevenue() const { return m_Revenue; }
+    float GetWageLevel() const { return m_WageLevel; }
+    double GetTotalEmployees() const { return static_cast<double>(m_Employees.m_Mean) * m_Population; }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+class CStateHash;
+
+// Hands out company IDs from a pool of slots. An ID is a slot index in the
+// low SLOT_BITS bits and the slot's generation above them. Releasing an ID
+// bumps its slot's generation and queues the slot, so a new firm reuses the
+// slot under a different ID. Queued slots are reused first in, first out,
+// which spreads reuse over all free slots, and a slot whose generations are
+// used up is retired instead of wrapping: no ID is ever handed out twice, so
+// handles to a closed firm never match a later one. Slot 0 is never handed
+// out (ID 0 = none), so a world without closures numbers its companies
+// 1, 2, 3, ... IDs stay below 2^31 and fit the UI's int32 selection.
+class CCompanyIDAllocator
+{
+public:
+    static constexpr uint32_t SLOT_BITS = 24;
+    static constexpr uint32_t SLOT_MASK = (1u << SLOT_BITS) - 1;
+    static constexpr uint32_t GENERATION_COUNT = 1u << 7;
+    static constexpr uint32_t INVALID_ID = 0;
+    static constexpr uint32_t MAX_LIVE_IDS = SLOT_MASK;    // Slot 0 is reserved
+
+private:
+    // Per slot: generation in the low 7 bits, LIVE_BIT while allocated. The
+    // last generation value marks a retired slot and is never handed out.
+    static constexpr uint8_t LIVE_BIT = 0x80;
+    static constexpr uint8_t GENERATION_MASK = 0x7F;
+    static constexpr uint8_t RETIRED = GENERATION_MASK;
+
+    std::vector<uint8_t> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;  // Released slots, reused first-in first-out from m_FreeHead
+    size_t m_FreeHead;
+    size_t m_LiveCount;
+    size_t m_RetiredCount;
+
+public:
+    CCompanyIDAllocator();
+    ~CCompanyIDAllocator() = default;
+
+    // Forget every ID (the next one is 1)
+    void Reset();
+
+    // New ID, or INVALID_ID once all slots are live
+    uint32_t Allocate();
+
+    // Return a live ID's slot to the pool, or retire the slot after its last
+    // generation (stale IDs are ignored)
+    void Release(uint32_t id);
+
+    bool IsAlive(uint32_t id) const;
+    static uint32_t GetSlot(uint32_t id) { return id & SLOT_MASK; }
+    static uint32_t GetGeneration(uint32_t id) { return id >> SLOT_BITS; }
+
+    size_t GetLiveCount() const { return m_LiveCount; }
+    size_t GetSlotCount() const { return m_Slots.size(); }
+    size_t GetFreeCount() const { return m_FreeSlots.size() - m_FreeHead; }
+    size_t GetRetiredCount() const { return m_RetiredCount; }
+
+    // Save file section (slot generations and free queue)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+
+    // The pool decides future IDs, so it is part of the replayed state
+    void HashState(CStateHash& hash) const;
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Economy/ECompanyTypes.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SMacroState.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace PoliticSim {
+
+// Column pointers for one batch of companies (all arrays hold m_Count entries)
+struct SFinancialBatch
+{
+    size_t m_Count;
+
+    // Inputs
+    const int32_t* m_Employees;
+    const float* m_BaseProductivity;
+    const float* m_CapacityUtilization;
+    const float* m_DomesticOrientation;
+    const float* m_WageLevel;
+    const float* m_LaborIntensity;
+    const float* m_Debt;
+    const ESector* m_Sectors;
+    const ECompanySize* m_Sizes;
+
+    // Outputs
+    float* m_Revenue;
+    float* m_Profitability;
+};
+
+// Per-tick constants hoisted out of the company loop. Sector and size
+// branches become table lookups (padded to 8 lanes for vector permutes).
+struct SFinancialCoefficients
+{
+    static constexpr int32_t TABLE_SIZE = 8;
+
+    float m_AggregateDemand;
+    float m_ConfidenceFactor;
+    float m_LaborTaxFactor;
+    float m_RegulationBurden;
+    float m_EnvironmentalCost;
+    float m_EnvironmentalMultiplier;
+    float m_TariffRate;
+    float m_MonthlyInterestRate;
+    float m_SubsidyRate;           // 0 when subsidies are disabled
+    float m_CorporateTaxRate;
+
+    float m_SectorSaturation[TABLE_SIZE];
+    float m_SectorImportCompetition[TABLE_SIZE];
+    float m_SectorTariffShare[TABLE_SIZE];
+    float m_SizeScaleAdvantage[TABLE_SIZE];
+};
+
+// Batched revenue/cost kernel. The vector paths evaluate the same
+// expressions in the same order as the scalar reference, 16 (AVX-512),
+// 8 (AVX2) or 4 (SSE2) companies at a time.
+class CCompanyKernels
+{
+public:
+    static SFinancialCoefficients BuildCoefficients(const SPolicyParams& policy, const SMacroState& macro);
+
+    // Widest instruction set available in this build
+    static void ComputeFinancials(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients);
+
+    // Same, for a batch whose companies all share one sector and size: the
+    // per-sector and per-size coefficients are broadcast once instead of
+    // looked up per company (same results as ComputeFinancials)
+    static void ComputeFinancialsBucket(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients);
+
+    // Reference implementation (also used for batch tails)
+    static void ComputeFinancialsScalar(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients);
+
+    static const char* GetInstructionSetName();
+};
+
+} // namespace PoliticSim
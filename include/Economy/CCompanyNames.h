@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Economy/ECompanyTypes.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Procedural company names. A name is a pure function of the company's ID
+// and sector, so companies store no strings: callers format a name into
+// their own buffer when they need one (UI rows, reports). A firm reusing a
+// closed firm's row has a new ID, and so a new name.
+class CCompanyNames
+{
+public:
+    // Longest name Format writes, including the terminator
+    static constexpr size_t MAX_LENGTH = 48;
+
+    // Writes "Silverbrook Farms"-style names into buffer (truncated to
+    // size - 1 characters, always terminated). Returns the length written.
+    static size_t Format(uint32_t id, ESector sector, char* buffer, size_t size);
+};
+
+} // namespace PoliticSim
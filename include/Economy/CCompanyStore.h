@@ -0,0 +1,283 @@
+#pragma once
+
+#include "Economy/ECompanyTypes.h"
+#include "Economy/SCompanyState.h"
+#include "Economy/SCompanyAttributes.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SMacroState.h"
+#include "Economy/SSimulationTick.h"
+#include "Economy/SCompanyAggregates.h"
+#include "Economy/CCompanyKernels.h"
+#include "Economy/CHistoryStore.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+class CStateHash;
+
+// Columnar (structure-of-arrays) storage for all simulated companies.
+// Each field lives in its own contiguous array indexed by company slot, so
+// the monthly tick and the macro aggregation stream through memory instead
+// of chasing one heap allocation per company.
+class CCompanyStore
+{
+public:
+    // Default window of the smoothed profit used for expectations
+    static constexpr int32_t DEFAULT_EXPECTATION_MONTHS = 24;
+
+    // Companies are simulated in blocks so every phase of the tick works on
+    // columns that are still in cache from the previous phase
+    static constexpr size_t SIMULATION_BLOCK_SIZE = 256;
+
+    // Shortest run of one sector x size that gets its own kernel batch
+    // (shorter runs are cheaper to batch with their neighbours)
+    static constexpr size_t MIN_BUCKET_RUN = 32;
+
+    // Liquidity below which a company is bankrupt
+    static constexpr float BANKRUPTCY_LIQUIDITY = -100.0f;
+
+    // FindRow result for IDs of no open company
+    static constexpr size_t INVALID_ROW = static_cast<size_t>(-1);
+
+private:
+    // Columns the monthly tick never writes. Forks share them with the
+    // store they came from until either side adds, removes, reorders or
+    // merges rows (copy-on-write, see Unshare).
+    struct SSharedColumns
+    {
+        // Identity (cold). Names are generated from the ID on demand
+        // (CCompanyNames), so no row owns a string.
+        std::vector<uint32_t> m_IDs;
+
+        // Row of each ID slot (see FindRow). Kept up to date for open rows
+        // only; closed and removed firms leave stale entries behind.
+        std::vector<uint32_t> m_RowOfSlot;
+
+        // Leaf region (rows are kept grouped by region, see SortByRegion)
+        std::vector<uint16_t> m_Regions;
+
+        // Attributes (what the company IS)
+        std::vector<ESector> m_Sectors;
+        std::vector<ECompanySize> m_Sizes;
+        std::vector<float> m_LaborIntensity;
+        std::vector<float> m_MarketCompetitiveness;
+        std::vector<float> m_DomesticOrientation;
+        std::vector<float> m_CapitalMobility;
+    };
+
+    std::shared_ptr<SSharedColumns> m_Shared;
+
+    // Sampling weight (firms of the modeled economy each row stands for)
+    std::vector<float> m_Weights;
+
+    // Productivity is an attribute, but reinvestment raises it during the tick
+    std::vector<float> m_BaseProductivity;
+
+    // State (how the company IS DOING)
+    std::vector<float> m_Liquidity;
+    std::vector<float> m_Profitability;
+    std::vector<float> m_Debt;
+    std::vector<float> m_LastRevenue;
+    std::vector<int32_t> m_Employees;
+    std::vector<float> m_WageLevel;
+    std::vector<float> m_CapacityUtilization;
+    std::vector<float> m_ExpectedProfit;
+    std::vector<float> m_AverageProfit;         // Smoothed profitability (expectation baseline)
+    std::vector<float> m_PerceivedRisk;
+    std::vector<ECompanyState> m_States;
+    std::vector<float> m_FormalityLevel;
+
+    // History (cold, kept in its own month-major store)
+    CHistoryStore m_History;
+
+    // Expectations
+    int32_t m_ExpectationMonths;
+    float m_ExpectationSmoothing;               // EMA weight of the newest month
+
+    // All phases of the tick over [begin, end) (open rows only)
+    void SimulateBlock(size_t begin, size_t end, const SFinancialCoefficients& coefficients,
+                       const SPolicyParams& policy, const SMacroState& macro, const SSimulationTick& tick);
+
+    // Per-phase kernels over [begin, end)
+    void CalculateFinancials(size_t begin, size_t end, const SFinancialCoefficients& coefficients);
+    void UpdateLiquidity(size_t begin, size_t end);
+    void UpdateHistory(size_t begin, size_t end);
+    void UpdateExpectations(size_t begin, size_t end);
+    void MakeDecisions(size_t begin, size_t end, const SPolicyParams& policy, const SMacroState& macro,
+                       const SSimulationTick& tick);
+    void CheckBankruptcy(size_t begin, size_t end);
+
+    // New row i takes old row order[i], in every column and the history
+    // (rows left out of the order are dropped)
+    void Reorder(const std::vector<size_t>& order);
+
+    // Stable counting sort by region, or by bucket (region, sector x size),
+    // optionally dropping closed rows
+    void GroupRows(bool byStratum, bool dropClosed);
+
+    // Shared columns for writing (copied first if a fork still uses them)
+    SSharedColumns& Unshare();
+
+    // Point the row's ID slot at it (open rows only), or re-point all slots
+    void IndexRow(SSharedColumns& shared, size_t index);
+    void RebuildRowIndex(SSharedColumns& shared);
+
+    // Every fixed-width column with its save tag, in file order (callers
+    // that write the columns unshare them first)
+    template <typename Self, typename Visitor>
+    static void ForEachColumn(Self& self, Visitor&& visit)
+    {
+        visit("CIDS", self.m_Shared->m_IDs);
+        visit("CWGT", self.m_Weights);
+        visit("CREG", self.m_Shared->m_Regions);
+        visit("CSEC", self.m_Shared->m_Sectors);
+        visit("CSIZ", self.m_Shared->m_Sizes);
+        visit("CPRD", self.m_BaseProductivity);
+        visit("CLAB", self.m_Shared->m_LaborIntensity);
+        visit("CCMP", self.m_Shared->m_MarketCompetitiveness);
+        visit("CDOM", self.m_Shared->m_DomesticOrientation);
+        visit("CCAP", self.m_Shared->m_CapitalMobility);
+        visit("SLIQ", self.m_Liquidity);
+        visit("SPRF", self.m_Profitability);
+        visit("SDBT", self.m_Debt);
+        visit("SREV", self.m_LastRevenue);
+        visit("SEMP", self.m_Employees);
+        visit("SWAG", self.m_WageLevel);
+        visit("SCAP", self.m_CapacityUtilization);
+        visit("SEXP", self.m_ExpectedProfit);
+        visit("SAVG", self.m_AverageProfit);
+        visit("SRSK", self.m_PerceivedRisk);
+        visit("SSTA", self.m_States);
+        visit("SFRM", self.m_FormalityLevel);
+    }
+
+public:
+    CCompanyStore();
+    ~CCompanyStore() = default;
+
+    // Copies share the columns the tick never writes (see Fork)
+    CCompanyStore(const CCompanyStore&) = default;
+    CCompanyStore& operator=(const CCompanyStore&) = default;
+    CCompanyStore(CCompanyStore&&) = default;
+    CCompanyStore& operator=(CCompanyStore&&) = default;
+
+    // Lifecycle
+    void Reserve(size_t capacity);
+    void Clear();
+    size_t AddCompany(uint32_t id, const SCompanyAttributes& attributes,
+                      float weight = 1.0f, uint16_t region = 0);
+
+    // Level-of-detail transfers. Weights move with the state, so the
+    // weighted aggregates are unchanged (up to rounding of headcounts).
+    // SplitCompany appends a weight-1 copy of a row and takes that weight
+    // from it; MergeCompany blends one row into another by weight and
+    // leaves 'from' for the caller to remove; RemoveCompany moves the last
+    // row into 'index'.
+    void SetWeight(size_t index, float weight) { m_Weights[index] = weight; }
+    size_t SplitCompany(size_t index, uint32_t id);
+    void MergeCompany(size_t from, size_t into);
+    void RemoveCompany(size_t index);
+
+    // Stable reorder of all rows into buckets: each leaf region is one
+    // contiguous range, and within it each sector x size is one run, so
+    // the tick sees long runs of companies with the same coefficients
+    // (after initialization, and after transfers that append or swap rows)
+    void SortByBucket();
+
+    // Stable reorder that only makes each leaf region contiguous (the order
+    // the tick needs; loaded saves keep their row order this way)
+    void SortByRegion();
+
+    // Bucket of a row: region * STRATUM_COUNT + sector x size stratum
+    size_t GetBucket(size_t index) const;
+
+    // Firm exit and entry. A closed company keeps its row at weight 0, so
+    // it counts for nothing and the tick skips it, until a new firm of the same region reuses the
+    // row (ReplaceCompany) or Compact drops it. Entrants of another sector
+    // or size break up their row's bucket until Compact, which also sorts
+    // the rows back into buckets.
+    void CloseCompany(size_t index);
+    bool IsClosed(size_t index) const { return m_Weights[index] <= 0.0f; }
+    void ReplaceCompany(size_t index, uint32_t id, const SCompanyAttributes& attributes,
+                        float weight, uint16_t region);
+    void Compact();
+
+    // Starting state of a new company (depends on size and sector)
+    static SCompanyState MakeInitialState(const SCompanyAttributes& attributes);
+
+    // Simulate one month for the open companies in [begin, end)
+    void SimulateRange(size_t begin, size_t end, const SPolicyParams& policy, const SMacroState& macro,
+                       const SSimulationTick& tick);
+    void SimulateCompany(size_t index, const SPolicyParams& policy, const SMacroState& macro,
+                         const SSimulationTick& tick);
+
+    // Advance the shared history write index (once per month, after all ranges)
+    void AdvanceHistory();
+
+    // History layout (drops recorded history)
+    void ConfigureHistory(const SHistoryConfig& config);
+
+    // Sum macro inputs (employment, revenue, profit, wages, per-sector
+    // counts) over [begin, end) in a single pass, each company scaled by
+    // its sampling weight
+    SCompanyAggregates Aggregate(size_t begin, size_t end) const;
+
+    // Expectation window in months (cost is the same for any length)
+    void SetExpectationWindow(int32_t months);
+    int32_t GetExpectationWindow() const { return m_ExpectationMonths; }
+    float GetExpectationSmoothing() const { return m_ExpectationSmoothing; }
+
+    size_t GetCount() const { return m_Weights.size(); }
+    bool IsEmpty() const { return m_Weights.empty(); }
+
+    // Copy for a what-if projection: shares the columns the tick never
+    // writes and copies the rest in bulk. Forks keep no history.
+    CCompanyStore Fork() const;
+
+    // Heap bytes held by all columns and history (approximate for names;
+    // columns shared with a fork are counted by both)
+    size_t GetMemoryBytes() const;
+
+    // Save file sections (columns are written and read whole, see CSaveWriter)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+
+    // Add every fixed-width column to a state hash (names and history are
+    // derived or constant and are left out)
+    void HashState(CStateHash& hash) const;
+
+    // Column access (read-only, for aggregation and UI)
+    const uint32_t* GetIDs() const { return m_Shared->m_IDs.data(); }
+    const float* GetWeights() const { return m_Weights.data(); }
+    const uint16_t* GetRegions() const { return m_Shared->m_Regions.data(); }
+    const ESector* GetSectors() const { return m_Shared->m_Sectors.data(); }
+    const ECompanySize* GetSizes() const { return m_Shared->m_Sizes.data(); }
+    const float* GetLiquidity() const { return m_Liquidity.data(); }
+    const float* GetProfitability() const { return m_Profitability.data(); }
+    const float* GetLastRevenue() const { return m_LastRevenue.data(); }
+    const int32_t* GetEmployees() const { return m_Employees.data(); }
+    const float* GetWageLevel() const { return m_WageLevel.data(); }
+    const float* GetCapacityUtilization() const { return m_CapacityUtilization.data(); }
+    const float* GetAverageProfit() const { return m_AverageProfit.data(); }
+    const ECompanyState* GetStates() const { return m_States.data(); }
+
+    // Row access (gathers one company, for UI)
+    // Row of an open company, or INVALID_ROW. O(1) through the slot of the
+    // ID, so it survives adds, removals, reorders and compaction.
+    size_t FindRow(uint32_t id) const;
+
+    // Display name into buffer (see CCompanyNames); returns its length
+    size_t FormatName(size_t index, char* buffer, size_t size) const;
+    SCompanyAttributes GetAttributes(size_t index) const;
+    SCompanyState GetState(size_t index) const;
+
+    // History access (UI graphs)
+    const CHistoryStore& GetHistory() const { return m_History; }
+};
+
+} // namespace PoliticSim
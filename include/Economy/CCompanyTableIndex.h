@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Economy/SCompanyTableQuery.h"
+#include "Economy/SEconomySnapshot.h"
+#include <cstdint>
+#include <vector>
+
+namespace PoliticSim {
+
+// Filtered, sorted list of snapshot rows for the company table. Built on
+// the simulation thread when a tick completes or the query changes, so the
+// UI only draws the rows in view (ImGuiListClipper) and never sorts.
+class CCompanyTableIndex
+{
+private:
+    SCompanyTableQuery m_Query;
+    std::vector<uint32_t> m_Rows;       // Snapshot rows, in table order
+    std::vector<uint64_t> m_Keys;       // Scratch: sort key << 32 | row
+    std::vector<uint64_t> m_SortBuffer; // Scratch: radix sort passes
+    uint32_t m_BuiltTick;
+    bool m_Dirty;
+
+    // Sort key of one row; ascending key order is ascending column order
+    static uint32_t GetSortKey(const SEconomySnapshot& snapshot, ECompanyTableColumn column, size_t row);
+
+    // Stable LSD radix sort of m_Keys by their upper 32 bits
+    void SortKeys();
+
+public:
+    CCompanyTableIndex();
+    ~CCompanyTableIndex() = default;
+
+    void SetQuery(const SCompanyTableQuery& query);
+    const SCompanyTableQuery& GetQuery() const { return m_Query; }
+
+    // Rebuild from the snapshot's company columns if the query or the tick
+    // changed since the last build. Returns true if rebuilt.
+    bool Update(const SEconomySnapshot& snapshot);
+
+    const std::vector<uint32_t>& GetRows() const { return m_Rows; }
+};
+
+} // namespace PoliticSim
@@ -2,61 +2,222 @@
 
 #include "Economy/SPolicyParams.h"
 #include "Economy/SMacroState.h"
-#include <vector>
-#include <memory>
+#include "Economy/SEconomyConfig.h"
+#include "Economy/CCompanyStore.h"
+#include "Economy/CCompany.h"
+#include "Economy/CCompanyCluster.h"
+#include "Economy/CSamplingStrategy.h"
+#include "Economy/CLODManager.h"
+#include "Economy/CFirmDynamics.h"
+#include "Economy/CCompanyIDAllocator.h"
+#include "Economy/CRegionMap.h"
+#include "Economy/CPolicyJournal.h"
+#include "Threading/CWorkerPool.h"
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace PoliticSim {
 
-// Forward declaration
-class CCompany;
-
 class CEconomyManager
 {
+public:
+    // Companies handed to each worker task (fixed, so chunking never
+    // depends on the thread count)
+    static constexpr size_t PARALLEL_GRAIN_SIZE = 16 * CCompanyStore::SIMULATION_BLOCK_SIZE;
+
+    // Real time Update may spend on catch-up ticks per frame (half a 60 FPS frame)
+    static constexpr float DEFAULT_TICK_BUDGET_SECONDS = 0.008f;
+
+    // Companies simulated between budget checks of a time-sliced month
+    static constexpr size_t TIME_SLICE_COMPANIES = 4 * CCompanyStore::SIMULATION_BLOCK_SIZE;
+
 private:
-    std::vector<std::unique_ptr<CCompany>> m_Companies;
+    SEconomyConfig m_Config;
+    CCompanyStore m_Companies;
+    std::vector<CCompanyCluster> m_Clusters;    // Tier-1 aggregates (micro-firms)
+    CSamplingStrategy m_Sampling;               // Strata of a sampled world (empty if unsampled)
+    CLODManager m_LOD;                          // Moves companies between tiers
+    CFirmDynamics m_FirmDynamics;               // Births and closures of companies
+    CCompanyIDAllocator m_CompanyIDs;           // Generation-counted company IDs
+    CRegionMap m_Regions;                       // Region hierarchy and regional macro states
+    CPolicyJournal m_Journal;                   // Policy changes and state hashes (when recording)
     SPolicyParams m_PolicyParams;
     SMacroState m_MacroState;
 
-    uint32_t m_NextCompanyID;
-    float m_SimulationAccumulator;  // Track game time for monthly ticks
+    float m_SimulationAccumulator;  // Track game time for monthly ticks (days owed)
+    float m_TickBudgetSeconds;      // Catch-up budget per Update
+    int32_t m_LastFrameTicks;       // Months run by the last Update
+
+    // Time-sliced month in progress (see AdvanceMonthSliced)
+    bool m_TimeSlicing;             // Update spreads each month over frames
+    bool m_SliceActive;
+    size_t m_SliceTask;             // Next region task
+    size_t m_SliceRow;              // Next row of that task
+    size_t m_SliceRowsDone;
+    SPolicyParams m_SlicePolicy;    // Policy frozen when the month started
+
+    // Determinism: every random draw is keyed by (seed, company, tick, stream)
+    uint32_t m_Tick;                // Months simulated since Initialize
 
     // Aggregates (calculated from companies)
+    double m_RepresentedCompanies;  // Firms represented by companies and clusters
     float m_TotalEmployment;
     float m_TotalGDP;
     float m_AverageProfitability;
 
+    // Parallel tick: one task per PARALLEL_GRAIN_SIZE chunk of a leaf region
+    struct SRegionTask
+    {
+        int32_t m_Leaf;
+        size_t m_Begin;
+        size_t m_End;
+    };
+
+    std::unique_ptr<CWorkerPool> m_WorkerPool;
+    std::vector<SRegionTask> m_RegionTasks;
+    std::vector<size_t> m_LeafFirstTask;                  // First task of each leaf (size = leaves + 1)
+    std::vector<SCompanyAggregates> m_AggregatePartials;  // One per task
+    std::vector<SFirmScan> m_FirmScans;                   // One per task
+
     // Internal helpers
     void InitializeCompanies();
-    void UpdateMacroState();
-    void SimulateAllCompanies();
+    void InitializeSampledCompanies();
+    void InitializeClusters();
+    void SimulateClusters(const SPolicyParams& policy, const SSimulationTick& tick);
+    void UpdateSliced();
+    void CommitMonth(const SPolicyParams& policy);
+    void UpdateFirmPopulation();
+    void ReviewLevelOfDetail();
+    void RebuildRegionTasks();
+    SCompanyAggregates AggregateCompanies();
+    void UpdateMacroState(const SPolicyParams& policy);
+    void ComputeMacroState(const SCompanyAggregates& aggregates, const SPolicyParams& policy, SMacroState& macro) const;
 
 public:
-    CEconomyManager();
-    ~CEconomyManager(); // Not default - needs full CCompany type definition
+    // threadCount as for SetWorkerThreadCount
+    explicit CEconomyManager(size_t threadCount = 0);
+    ~CEconomyManager() = default;
 
-    // Lifecycle
-    void Initialize();
+    // Lifecycle (the same config always produces the same world and history)
+    void Initialize(const SEconomyConfig& config = SEconomyConfig());
     void Shutdown();
 
-    // Main update (called from game loop, receives game delta time)
+    // Binary save of the whole economy: config, clock, policy, macro state,
+    // companies with their history, clusters and tiers (see SSaveFormat).
+    // A loaded economy continues exactly as the saved one would have. Not
+    // allowed while a time-sliced month is in progress. LoadState keeps the
+    // current worker thread count; on a damaged file it reports the problem
+    // and leaves the economy empty.
+    bool SaveState(const std::string& path) const;
+    bool LoadState(const std::string& path);
+
+    // Independent copy for what-if projections, run on a single thread.
+    // Company attributes the tick never writes are shared copy-on-write
+    // (see CCompanyStore::Fork); mutable state is copied in bulk. A month
+    // in progress is finished by the fork. No history and no journal. The
+    // fork must be destroyed on the thread that owns this economy.
+    std::unique_ptr<CEconomyManager> Fork() const;
+
+    // Main update (called from game loop, receives game delta time).
+    // Runs as many monthly ticks as are owed, within the tick budget.
     void Update(float gameDelta);
 
-    // Policy access (for UI)
-    SPolicyParams& GetPolicyParams() { return m_PolicyParams; }
+    // Catch-up scheduling. Lag is game time owed but not yet simulated.
+    void SetTickBudget(float seconds) { m_TickBudgetSeconds = seconds; }
+    float GetTickBudget() const { return m_TickBudgetSeconds; }
+    int32_t GetLastFrameTicks() const { return m_LastFrameTicks; }
+    int32_t GetPendingMonths() const;
+    float GetLagDays() const { return m_SimulationAccumulator; }
+
+    // Run one monthly tick immediately (headless drivers, no game time)
+    void AdvanceMonth();
+
+    // Time-sliced tick: simulate up to 'companies' more rows of the current
+    // month against the policy and macro state frozen when it started. The
+    // month (history, clusters, macro state, tick) commits at once when the
+    // last row is done; returns true then. Rows already done hold next
+    // month's values until the commit. Results match AdvanceMonth exactly.
+    bool AdvanceMonthSliced(size_t companies);
+    bool IsMonthInProgress() const { return m_SliceActive; }
+    float GetMonthProgress() const;
+
+    // Update works in TIME_SLICE_COMPANIES steps, spreading each month over
+    // the frames before it is due (single-threaded frame pacing)
+    void SetTimeSlicing(bool enabled) { m_TimeSlicing = enabled; }
+    bool IsTimeSlicing() const { return m_TimeSlicing; }
+
+    // The two phases of a tick, in AdvanceMonth order (public for profiling)
+    void SimulateAllCompanies();
+    void UpdateMacroState();
+
+    // Typical attributes of a company in a sector
+    static SCompanyAttributes MakeSectorAttributes(ESector sector, ECompanySize size);
+
+    // Threading (0 = one thread per hardware core). Results are identical
+    // for every thread count.
+    void SetWorkerThreadCount(size_t threadCount);
+    size_t GetWorkerThreadCount() const { return m_WorkerPool->GetThreadCount(); }
+
+    // Configuration and determinism
+    const SEconomyConfig& GetConfig() const { return m_Config; }
+    uint64_t GetWorldSeed() const { return m_Config.m_WorldSeed; }
+    uint32_t GetTick() const { return m_Tick; }
+
+    // Policy access. Changes go through SetPolicyParams so the journal sees
+    // them; during a time-sliced month they apply from the next month.
+    void SetPolicyParams(const SPolicyParams& policy);
     const SPolicyParams& GetPolicyParams() const { return m_PolicyParams; }
 
+    // Session journal (see CPolicyJournal). Recording starts from a world at
+    // month 0, so it is refused after a month has run; Initialize restarts
+    // it and LoadState stops it. Each committed month adds a state hash.
+    bool StartJournal();
+    void StopJournal() { m_Journal.Stop(); }
+    const CPolicyJournal& GetJournal() const { return m_Journal; }
+
+    // Hash of everything a month changes: company columns, clusters, macro
+    // states and totals. Equal for every thread count and slicing.
+    uint64_t ComputeStateHash() const;
+
     // Macro state access (read-only, calculated internally)
     const SMacroState& GetMacroState() const { return m_MacroState; }
 
+    // Regions with their own totals and macro state (read-only)
+    const CRegionMap& GetRegions() const { return m_Regions; }
+
     // Company access (for UI)
-    const std::vector<std::unique_ptr<CCompany>>& GetCompanies() const { return m_Companies; }
-    size_t GetCompanyCount() const { return m_Companies.size(); }
+    const CCompanyStore& GetCompanyStore() const { return m_Companies; }
+    CCompany GetCompany(size_t index) const { return CCompany(m_Companies, index); }
+
+    // Row of the open company with this ID, or CCompanyStore::INVALID_ROW
+    // (constant time; rows move, so look IDs up again after a month ends)
+    size_t FindCompany(uint32_t id) const { return m_Companies.FindRow(id); }
+    size_t GetCompanyCount() const { return m_Companies.GetCount(); }
+
+    // Sampling tier (firms in the modeled economy, >= GetCompanyCount())
+    const CSamplingStrategy& GetSampling() const { return m_Sampling; }
+    double GetRepresentedCompanyCount() const { return m_RepresentedCompanies; }
+
+    // Level of detail (for UI)
+    const CLODManager& GetLOD() const { return m_LOD; }
+
+    // Firm entry and exit, and the IDs of live companies (for UI)
+    const CFirmDynamics& GetFirmDynamics() const { return m_FirmDynamics; }
+    const CCompanyIDAllocator& GetCompanyIDs() const { return m_CompanyIDs; }
+
+    // Cluster access (for UI)
+    const std::vector<CCompanyCluster>& GetClusters() const { return m_Clusters; }
 
     // Aggregates (for UI)
     float GetTotalEmployment() const { return m_TotalEmployment; }
     float GetTotalGDP() const { return m_TotalGDP; }
     float GetAverageProfitability() const { return m_AverageProfitability; }
+
+    // Economy-wide profit over revenue of the last month (reference for
+    // firm entry)
+    float GetProfitMargin() const;
     float GetUnemploymentRate() const { return m_MacroState.m_UnemploymentRate; }
 };
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Economy/CEconomyManager.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SProjectionSeries.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace PoliticSim {
+
+// Runs a fork of the economy some months ahead on a background thread
+// (one projection at a time) and collects its macro series. Start, Cancel
+// and TakeResult are called from the thread that owns the economy, which
+// also creates and destroys every fork (see CEconomyManager::Fork).
+class CEconomyProjection
+{
+private:
+    std::unique_ptr<CEconomyManager> m_Fork;
+    std::thread m_Thread;
+    std::atomic<bool> m_Cancel;
+    std::atomic<bool> m_Finished;           // m_Series is complete (release/acquire)
+    std::function<void()> m_OnFinished;
+    SProjectionSeries m_Series;             // Written by the projection thread until m_Finished
+    uint32_t m_Generation;
+
+    void Run(int32_t months);
+
+public:
+    CEconomyProjection();
+    ~CEconomyProjection();
+
+    CEconomyProjection(const CEconomyProjection&) = delete;
+    CEconomyProjection& operator=(const CEconomyProjection&) = delete;
+
+    // Fork 'economy', switch the fork to 'policy' (from the next month if
+    // one is in progress) and project 'months' months. Cancels a running
+    // projection. onFinished runs on the projection thread when done.
+    void Start(const CEconomyManager& economy, const SPolicyParams& policy, int32_t months,
+               std::function<void()> onFinished = std::function<void()>());
+
+    // Stop the running projection and drop its fork (blocks for at most
+    // one month of the fork)
+    void Cancel();
+
+    bool IsRunning() const { return m_Thread.joinable() && !m_Finished.load(std::memory_order_acquire); }
+
+    // Finished series, once per projection; drops the fork
+    bool TakeResult(SProjectionSeries& series);
+
+    // Append the economy's current month to every series
+    static void AppendMonth(const CEconomyManager& economy, SProjectionSeries& series);
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Economy/SFirmDynamicsConfig.h"
+#include "Economy/CCompanyStore.h"
+#include "Economy/CCompanyIDAllocator.h"
+#include "Economy/CRegionMap.h"
+#include "Economy/CSamplingStrategy.h"
+#include "Economy/SSimulationTick.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PoliticSim {
+
+// Companies of one sector x size stratum at the end of a month
+struct SFirmStratumTotals
+{
+    // Survivors
+    int64_t m_Rows;
+    double m_Weight;
+    double m_Profit;        // Weighted sum of profitability
+    double m_Revenue;       // Weighted sum of revenue
+
+    // Closing this month (bankrupt ones included)
+    int64_t m_ExitRows;
+    double m_ExitWeight;
+
+    SFirmStratumTotals()
+        : m_Rows(0)
+        , m_Weight(0.0)
+        , m_Profit(0.0)
+        , m_Revenue(0.0)
+        , m_ExitRows(0)
+        , m_ExitWeight(0.0)
+    {
+    }
+};
+
+// What a month-end scan found in one range of one leaf region's rows
+struct SFirmScan
+{
+    int32_t m_Leaf;
+    SFirmStratumTotals m_Strata[CSamplingStrategy::STRATUM_COUNT];  // Survivors
+    std::vector<size_t> m_Closing;      // Live rows closing this month
+    std::vector<size_t> m_Empty;        // Rows closed in earlier months
+};
+
+// Firm birth and death of the individual tier (design doc section 16), at
+// the end of each month. Scan looks at rows in parallel, one range of one
+// leaf at a time, and picks the firms that close: bankrupt ones, and others
+// at their size's normal turnover rate. Apply then runs serially in range
+// order: it closes those firms, releases their IDs, and creates each
+// region's entrants (as many firms as closed there) in the closed rows of
+// the region, appending rows only when none are left. Every draw is keyed
+// by company or stratum, so the result does not depend on the thread count.
+// Clusters model the same turnover for their own firms.
+class CFirmDynamics
+{
+private:
+    SFirmDynamicsConfig m_Config;
+
+    // Scratch, reused between months
+    std::vector<SFirmStratumTotals> m_Strata;   // Per (leaf, stratum)
+    std::vector<size_t> m_FreeRows;             // Closed rows, grouped by leaf
+    std::vector<size_t> m_LeafFreeRows;         // First free row of each leaf (size = leaves + 1)
+
+    int64_t m_LastEntries;
+    int64_t m_LastExits;
+    size_t m_LastEmptyRows;
+
+public:
+    CFirmDynamics();
+    ~CFirmDynamics() = default;
+
+    // Monthly share of firms that close without going bankrupt (design doc
+    // section 16 annual turnover / 12)
+    static float GetMonthlyTurnover(ECompanySize size);
+
+    // Monthly entrants per firm of the start of the month, before the
+    // region-wide scaling. In a neutral market (profit margin and sector
+    // saturation equal to the reference) entry replaces exit. Better margins
+    // draw more entrants and more saturated sectors fewer (each by up to
+    // half the exit rate).
+    static float GetEntryRate(float exitRate, float margin, float referenceMargin,
+                              float saturation, float referenceSaturation);
+
+    // Profit over revenue (0 without revenue)
+    static float GetProfitMargin(double profit, double revenue);
+
+    // Mean saturation of the sectors of a region (reference for entry)
+    static float GetMeanSaturation(const SMacroState& macro);
+
+    void Configure(const SFirmDynamicsConfig& config);
+    const SFirmDynamicsConfig& GetConfig() const { return m_Config; }
+    bool IsEnabled() const { return m_Config.m_Enabled; }
+    bool IsCompactionDue(uint32_t month) const;
+
+    // Rows [begin, end) of one leaf (reads only; safe to run in parallel
+    // on disjoint ranges)
+    void Scan(const CCompanyStore& companies, size_t begin, size_t end, int32_t leaf,
+              const SSimulationTick& tick, SFirmScan& scan) const;
+
+    // Close and create firms from the month's scans (in region order).
+    // Each leaf's entrants replace its exits; they go to strata by their
+    // margin against 'referenceMargin' (the economy's) and their sector's
+    // saturation against the leaf's mean.
+    // Returns true if rows were appended.
+    bool Apply(CCompanyStore& companies, CCompanyIDAllocator& ids, const CRegionMap& regions,
+               const std::vector<SFirmScan>& scans, const SSimulationTick& tick, float referenceMargin);
+
+    // Firms that entered and closed in the last month (sampling weights
+    // included)
+    int64_t GetLastEntries() const { return m_LastEntries; }
+    int64_t GetLastExits() const { return m_LastExits; }
+
+    // Closed rows no entrant reused in the last month
+    size_t GetLastEmptyRows() const { return m_LastEmptyRows; }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Economy/EHistoryTypes.h"
+#include "Economy/SHistoryConfig.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+
+// Monthly history of per-company metrics, kept apart from the hot company
+// columns. Each metric is stored month-major: one column of all companies
+// per month, and a single write index shared by every company, so a tick
+// appends one contiguous column per metric.
+class CHistoryStore
+{
+private:
+    static constexpr int32_t METRIC_COUNT = static_cast<int32_t>(EHistoryMetric::COUNT);
+
+    SHistoryConfig m_Config;
+    size_t m_Count;             // Companies tracked
+    size_t m_Stride;            // Allocated companies per month column
+    int32_t m_WriteIndex;       // Month column written this tick
+
+    // Only the vector matching m_Config.m_Precision is used
+    std::vector<float> m_Float32[METRIC_COUNT];
+    std::vector<uint16_t> m_Float16[METRIC_COUNT];
+
+    void Regrow(size_t stride);
+    size_t GetSlot(size_t company, int32_t month) const { return static_cast<size_t>(month) * m_Stride + company; }
+
+public:
+    CHistoryStore();
+    ~CHistoryStore() = default;
+
+    // Lifecycle (Configure drops all recorded history)
+    void Configure(const SHistoryConfig& config);
+    void Reserve(size_t companyCount);
+    void Resize(size_t companyCount);
+    void Clear();
+
+    // Write this month's values for companies [begin, end).
+    // values[0] belongs to company 'begin'. Ignored if the metric is not kept.
+    void Record(EHistoryMetric metric, size_t begin, size_t end, const float* values);
+    void Record(EHistoryMetric metric, size_t begin, size_t end, const int32_t* values);
+
+    // Move to the next month column (once per month, after all ranges)
+    void Advance();
+
+    // Copy every month of one company's history over another's
+    void CopyCompany(size_t from, size_t to);
+
+    // Zero every month of one company's history (a new firm in a reused row)
+    void ClearCompany(size_t company);
+
+    // Company i takes the history of company order[i]; companies left out
+    // of the order are dropped (order.size() <= count)
+    void Reorder(const std::vector<size_t>& order);
+
+    // Queries
+    const SHistoryConfig& GetConfig() const { return m_Config; }
+    size_t GetCount() const { return m_Count; }
+    int32_t GetDepth() const { return m_Config.m_Depth; }
+    int32_t GetWriteIndex() const { return m_WriteIndex; }
+    bool IsRecorded(EHistoryMetric metric) const { return (m_Config.m_MetricMask & SHistoryConfig::MetricBit(metric)) != 0; }
+    size_t GetMemoryBytes() const;
+
+    // Save file sections (month-major columns with the stride packed to the count)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+
+    // Sample stored in ring slot 'month' (0 if the metric is not kept)
+    float GetValue(EHistoryMetric metric, size_t company, int32_t month) const;
+
+    // Copy GetDepth() samples for one company, oldest to newest
+    void CopySeries(EHistoryMetric metric, size_t company, float* out) const;
+};
+
+} // namespace PoliticSim
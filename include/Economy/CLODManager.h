@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Economy/SLODConfig.h"
+#include "Economy/CCompanyStore.h"
+#include "Economy/CCompanyCluster.h"
+#include "Economy/CCompanyIDAllocator.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoliticSim {
+
+// Moves companies between the three representations of the economy:
+// full agents (weight 1 rows), sampled rows (weight > 1, one row per many
+// firms) and aggregate clusters. Every few months it scores each row and
+//  - demotes the least important full agents into their region's sector x
+//    size stratum (the stratum's cluster if there is one, else its sampled
+//    row) until the full-agent budget is met,
+//  - swaps agents below the demote threshold for sampled firms above the
+//    promote threshold (the gap between the two is the hysteresis),
+//  - absorbs unimportant sampled rows into a matching cluster,
+//  - fills the free budget by splitting full agents off the most important
+//    sampled rows.
+// Weights travel with the state, so aggregate totals are preserved. The
+// full-agent count stays at the budget (as long as there are firms to
+// promote), and a review never takes the row count past the count at
+// Configure, so tick cost stays flat.
+class CLODManager
+{
+private:
+    SLODConfig m_Config;
+    size_t m_RowBudget;             // Rows allowed in the store
+
+    // Scratch, reused between reviews
+    std::vector<float> m_Scores;
+    std::vector<size_t> m_Candidates;         // Full agents
+    std::vector<size_t> m_Promotable;         // Sampled rows that can split off an agent
+    std::vector<uint8_t> m_Planned;           // Per row: already leaving the store
+    std::vector<uint8_t> m_SinkIsAgent;       // Per (region, stratum): sink is still a full agent
+    std::vector<size_t> m_Removed;
+    std::vector<int32_t> m_ClusterSinks;    // Per (region, stratum): cluster index or -1
+    std::vector<int64_t> m_RowSinks;        // Per (region, stratum): sampled row or -1
+
+    int32_t m_LastPromotions;
+    int32_t m_LastDemotions;
+    int32_t m_FullAgentCount;
+
+public:
+    CLODManager();
+    ~CLODManager() = default;
+
+    void Configure(const SLODConfig& config, size_t rowBudget);
+    const SLODConfig& GetConfig() const { return m_Config; }
+    bool IsEnabled() const { return m_Config.m_ReviewInterval > 0; }
+    bool IsReviewDue(uint32_t month) const;
+
+    // Importance of one row of the store
+    float ScoreCompany(const CCompanyStore& companies, size_t index) const;
+
+    // Re-tier the companies. New full agents take their IDs from 'ids', and
+    // the IDs of rows merged away are released to it.
+    void Review(CCompanyStore& companies, std::vector<CCompanyCluster>& clusters, CCompanyIDAllocator& ids);
+
+    // Results of the last review
+    int32_t GetLastPromotions() const { return m_LastPromotions; }
+    int32_t GetLastDemotions() const { return m_LastDemotions; }
+    int32_t GetFullAgentCount() const { return m_FullAgentCount; }
+    int32_t GetFullAgentBudget() const { return m_Config.m_FullAgentBudget; }
+
+    // Save file section (config, row budget and last results)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+};
+
+} // namespace PoliticSim
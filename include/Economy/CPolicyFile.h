@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Economy/SPolicyParams.h"
+#include <iosfwd>
+#include <string>
+
+namespace PoliticSim {
+
+// Plain-text policy files for headless runs.
+// One "Key = Value" per line, '#' starts a comment. Keys are the
+// SPolicyParams field names without the m_ prefix (e.g. TariffRate = 25).
+// Keys that are not present keep their current value.
+class CPolicyFile
+{
+public:
+    // Returns false (and reports the line) on unknown keys or bad values
+    static bool Load(const std::string& path, SPolicyParams& params);
+    static bool Parse(std::istream& input, const std::string& sourceName, SPolicyParams& params);
+
+    static bool Save(const std::string& path, const SPolicyParams& params);
+    static void Write(std::ostream& output, const SPolicyParams& params);
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Economy/SEconomyConfig.h"
+#include "Economy/SPolicyParams.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PoliticSim {
+
+// SPolicyParams fields, in declaration order
+enum class EPolicyField : uint8_t
+{
+    CorporateTaxRate,
+    LaborTaxRate,
+    MinimumWage,
+    LaborRegulationBurden,
+    EnvironmentalComplianceCost,
+    StrictEnvironmentalPolicy,
+    SubsidyRate,
+    SubsidiesEnabled,
+    TariffRate,
+
+    // Count of fields (for iteration)
+    COUNT = 9
+};
+
+// One policy field changing value
+struct SPolicyChange
+{
+    uint32_t m_Tick;            // First month simulated with the new value
+    EPolicyField m_Field;
+    float m_OldValue;           // Booleans are 0 or 1
+    float m_NewValue;
+
+    SPolicyChange()
+        : m_Tick(0)
+        , m_Field(EPolicyField::CorporateTaxRate)
+        , m_OldValue(0.0f)
+        , m_NewValue(0.0f)
+    {
+    }
+};
+
+// Append-only record of a session: the world it started from (config and
+// seed at month 0), the starting policy, every policy change and the state
+// hash after every month. Replaying the changes on the same world must
+// reproduce every hash, so a recorded session is an exact, repeatable
+// workload. Saved with CSaveWriter (chunks JRNL, JPOL, JHSH).
+class CPolicyJournal
+{
+private:
+    SEconomyConfig m_Config;
+    SPolicyParams m_InitialPolicy;
+    std::vector<SPolicyChange> m_Changes;   // In tick order
+    std::vector<uint64_t> m_StateHashes;    // [i] = hash after month i + 1
+    bool m_Recording;
+
+public:
+    CPolicyJournal();
+    ~CPolicyJournal() = default;
+
+    // Recording (CEconomyManager calls these once Start has been called)
+    void Start(const SEconomyConfig& config, const SPolicyParams& policy);
+    void Stop() { m_Recording = false; }
+    bool IsRecording() const { return m_Recording; }
+
+    // One change per field that differs between the two policies
+    void RecordPolicy(uint32_t tick, const SPolicyParams& before, const SPolicyParams& after);
+    void RecordStateHash(uint64_t hash) { m_StateHashes.push_back(hash); }
+
+    // Replay: apply the changes for 'tick' starting at index 'next';
+    // returns the index of the first change of a later tick
+    size_t ApplyChanges(uint32_t tick, size_t next, SPolicyParams& policy) const;
+
+    bool Save(const std::string& path) const;
+    bool Load(const std::string& path);
+
+    // Accessors
+    const SEconomyConfig& GetConfig() const { return m_Config; }
+    const SPolicyParams& GetInitialPolicy() const { return m_InitialPolicy; }
+    const std::vector<SPolicyChange>& GetChanges() const { return m_Changes; }
+    uint32_t GetMonthCount() const { return static_cast<uint32_t>(m_StateHashes.size()); }
+    uint64_t GetStateHash(uint32_t tick) const { return m_StateHashes[tick - 1]; }
+
+    // Field access by enum
+    static float GetField(const SPolicyParams& policy, EPolicyField field);
+    static void SetField(SPolicyParams& policy, EPolicyField field, float value);
+    static const char* GetFieldName(EPolicyField field);
+};
+
+} // namespace PoliticSim
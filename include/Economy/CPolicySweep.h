@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Economy/SEconomyConfig.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SProjectionSeries.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+
+// One metric of one policy across a sweep's seeds, per month
+struct SSweepBand
+{
+    std::vector<float> m_Mean;
+    std::vector<float> m_Low;   // Mean - CONFIDENCE_Z standard errors
+    std::vector<float> m_High;  // Mean + CONFIDENCE_Z standard errors
+};
+
+// Monte Carlo policy sweep: every policy runs for the same months on every
+// seed, each run an independent world. A seed's world is built once and
+// every policy runs on a fork of it (CEconomyManager::Fork), so the runs of
+// a seed share its company attributes. Runs are claimed dynamically by the
+// threads of a CWorkerPool; results do not depend on the thread count.
+//
+// Result file (CSaveWriter chunks): SWEP holds the world config, month,
+// policy and seed counts, the policies and the seeds. SRUN holds every run
+// in seed-major order, each as its EProjectionMetric series back to back;
+// runs are written in that order as soon as they and all earlier runs are
+// done. SBND holds each policy's mean, low and high series per metric.
+class CPolicySweep
+{
+public:
+    static constexpr int32_t METRIC_COUNT = static_cast<int32_t>(EProjectionMetric::COUNT);
+
+    // Half-width of the bands in standard errors (95% for a normal mean)
+    static constexpr float CONFIDENCE_Z = 1.96f;
+
+private:
+    SEconomyConfig m_Config;
+    std::vector<SPolicyParams> m_Policies;
+    std::vector<uint64_t> m_Seeds;
+    int32_t m_Months;
+    std::vector<SProjectionSeries> m_Runs;  // [seed * policies + policy]
+    std::vector<SSweepBand> m_Bands;        // [policy * METRIC_COUNT + metric]
+
+    void WriteHeader(CSaveWriter& writer) const;
+    void WriteRun(CSaveWriter& writer, size_t run) const;
+    void WriteBands(CSaveWriter& writer) const;
+    void ComputeBands();
+
+public:
+    CPolicySweep();
+    ~CPolicySweep() = default;
+
+    // The config's seed and thread count are replaced per run
+    void Configure(const SEconomyConfig& config, const std::vector<SPolicyParams>& policies,
+                   const std::vector<uint64_t>& seeds, int32_t months);
+
+    // Run every policy on every seed on 'threadCount' threads (0 = one per
+    // core) and stream the results to 'resultPath' (empty = no file).
+    // Returns false if the file cannot be written.
+    bool Run(size_t threadCount, const std::string& resultPath = std::string());
+
+    // Accessors
+    size_t GetPolicyCount() const { return m_Policies.size(); }
+    size_t GetSeedCount() const { return m_Seeds.size(); }
+    int32_t GetMonths() const { return m_Months; }
+    const SPolicyParams& GetPolicy(size_t policy) const { return m_Policies[policy]; }
+    const SProjectionSeries& GetRun(size_t policy, size_t seed) const { return m_Runs[seed * m_Policies.size() + policy]; }
+    const SSweepBand& GetBand(size_t policy, EProjectionMetric metric) const
+    {
+        return m_Bands[policy * METRIC_COUNT + static_cast<size_t>(metric)];
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Economy/SRegionConfig.h"
+#include "Economy/SMacroState.h"
+#include "Economy/SCompanyAggregates.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+
+// Region hierarchy of the economy. Companies are stored grouped by leaf
+// region, so each leaf owns one contiguous range of company rows; the
+// leaf's totals are folded up the tree into its parents and the nation.
+class CRegionMap
+{
+public:
+    // Leaf indices are stored per company as uint16_t
+    static constexpr int32_t MAX_LEAVES = 65535;
+
+private:
+    std::vector<SRegionConfig> m_Regions;
+    std::vector<int32_t> m_Leaves;                  // Region index of each leaf
+    std::vector<int32_t> m_LeafOfRegion;            // Leaf index of each region, -1 if it has children
+    std::vector<size_t> m_LeafBegin;                // Row range of each leaf (size = leaves + 1)
+
+    // Per region
+    std::vector<SMacroState> m_MacroStates;
+    std::vector<SCompanyAggregates> m_Aggregates;
+
+public:
+    CRegionMap();
+    ~CRegionMap() = default;
+
+    // Build the hierarchy (an empty list is one national leaf). On an
+    // invalid hierarchy, reports the problem and keeps one national leaf.
+    bool Configure(const std::vector<SRegionConfig>& regions);
+
+    // Split 'total' over the leaves by company share (sums to total)
+    std::vector<int64_t> SplitByShare(int64_t total) const;
+
+    // Recompute leaf row ranges from per-company leaf indices (sorted)
+    void SetLeafRanges(const uint16_t* leaves, size_t count);
+
+    // Fold leaf aggregates into every ancestor; returns the national total
+    SCompanyAggregates AggregateUp();
+
+    // Queries
+    int32_t GetRegionCount() const { return static_cast<int32_t>(m_Regions.size()); }
+    int32_t GetLeafCount() const { return static_cast<int32_t>(m_Leaves.size()); }
+    int32_t GetLeafRegion(int32_t leaf) const { return m_Leaves[leaf]; }
+    bool IsLeaf(int32_t region) const { return m_LeafOfRegion[region] >= 0; }
+    const std::string& GetName(int32_t region) const { return m_Regions[region].m_Name; }
+    int32_t GetParent(int32_t region) const { return m_Regions[region].m_Parent; }
+    size_t GetLeafBegin(int32_t leaf) const { return m_LeafBegin[leaf]; }
+    size_t GetLeafEnd(int32_t leaf) const { return m_LeafBegin[leaf + 1]; }
+
+    SMacroState& GetMacroState(int32_t region) { return m_MacroStates[region]; }
+    const SMacroState& GetMacroState(int32_t region) const { return m_MacroStates[region]; }
+    const SMacroState& GetLeafMacroState(int32_t leaf) const { return m_MacroStates[m_Leaves[leaf]]; }
+
+    SCompanyAggregates& GetAggregates(int32_t region) { return m_Aggregates[region]; }
+    const SCompanyAggregates& GetAggregates(int32_t region) const { return m_Aggregates[region]; }
+    SCompanyAggregates& GetLeafAggregates(int32_t leaf) { return m_Aggregates[m_Leaves[leaf]]; }
+
+    // Save file section (per-region macro states and totals; the hierarchy
+    // itself comes from Configure and must match)
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+};
+
+} // namespace PoliticSim
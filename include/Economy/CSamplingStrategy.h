@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Economy/ECompanyTypes.h"
+#include <cstdint>
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+
+// One sector x size stratum of the modeled economy
+struct SStratumSample
+{
+    int64_t m_Population;   // Firms in the modeled economy
+    float m_Variability;    // Relative spread of the firms (Neyman allocation)
+    int32_t m_SampleSize;   // Companies simulated
+    float m_Weight;         // Firms each simulated company stands for
+
+    SStratumSample()
+        : m_Population(0)
+        , m_Variability(1.0f)
+        , m_SampleSize(0)
+        , m_Weight(0.0f)
+    {
+    }
+};
+
+// Sizes the sample of every sector x size stratum for a fixed budget of
+// simulated companies. Uses Neyman allocation (sample proportional to
+// population x spread) so large, heterogeneous strata get more companies,
+// after a guaranteed minimum per stratum.
+class CSamplingStrategy
+{
+public:
+    static constexpr int32_t SIZE_COUNT = 4;
+    static constexpr int32_t STRATUM_COUNT = static_cast<int32_t>(ESector::COUNT) * SIZE_COUNT;
+
+private:
+    SStratumSample m_Strata[STRATUM_COUNT];
+
+public:
+    CSamplingStrategy() = default;
+    ~CSamplingStrategy() = default;
+
+    static int32_t GetStratumIndex(ESector sector, ECompanySize size)
+    {
+        return static_cast<int32_t>(sector) * SIZE_COUNT + static_cast<int32_t>(size);
+    }
+    static ESector GetStratumSector(int32_t stratum) { return static_cast<ESector>(stratum / SIZE_COUNT); }
+    static ECompanySize GetStratumSize(int32_t stratum) { return static_cast<ECompanySize>(stratum % SIZE_COUNT); }
+
+    // Describe the modeled economy (clears any previous allocation)
+    void Clear();
+    void SetPopulation(ESector sector, ECompanySize size, int64_t population, float variability);
+
+    // Split sampleBudget companies over the strata and compute their
+    // weights. Strata left without a sample (budget too small) get weight 0.
+    void Allocate(int32_t sampleBudget, int32_t minimumPerStratum);
+
+    const SStratumSample& GetStratum(int32_t stratum) const { return m_Strata[stratum]; }
+    int64_t GetTotalPopulation() const;
+    int32_t GetTotalSampleSize() const;
+
+    // Save file section
+    void Save(CSaveWriter& writer) const;
+    bool Load(CSaveReader& reader);
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Economy/CEconomyManager.h"
+#include "Economy/CCompanyTableIndex.h"
+#include "Economy/CEconomyProjection.h"
+#include "Economy/SEconomySnapshot.h"
+#include "Economy/SPolicyParams.h"
+#include "Threading/CSPSCQueue.h"
+#include "Threading/CTripleBuffer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace PoliticSim {
+
+// Commands sent from the UI thread to the simulation thread
+enum class ESimulationCommand : uint8_t
+{
+    AdvanceTime,    // m_GameDelta seconds of game time have passed
+    SetPolicy,      // Replace the policy with m_Policy
+    SelectCompany,  // Include m_CompanyID's detail and history in snapshots
+    Project,        // Project m_Months months ahead under m_Policy (what-if)
+    QueryTable      // Filter and sort the snapshots' company table by m_TableQuery
+};
+
+struct SSimulationCommand
+{
+    ESimulationCommand m_Type;
+    float m_GameDelta;
+    SPolicyParams m_Policy;
+    int32_t m_CompanyID;
+    int32_t m_Months;
+    SCompanyTableQuery m_TableQuery;
+
+    SSimulationCommand()
+        : m_Type(ESimulationCommand::AdvanceTime)
+        , m_GameDelta(0.0f)
+        , m_Policy()
+        , m_CompanyID(-1)
+        , m_Months(0)
+        , m_TableQuery()
+    {
+    }
+};
+
+// Runs a CEconomyManager on its own thread so long ticks never stall the
+// frame. The UI sends commands through a lock-free queue (applied between
+// ticks) and reads the newest SEconomySnapshot from a triple buffer. While
+// the thread runs, the economy must not be touched from any other thread.
+// Without a thread (single-core machines) the UI calls Pump each frame and
+// the economy runs time-sliced ticks on the UI thread instead.
+class CSimulationThread
+{
+public:
+    static constexpr size_t COMMAND_CAPACITY = 256;
+
+private:
+    CEconomyManager& m_Economy;
+    std::thread m_Thread;
+    bool m_Inline;                          // Started without a thread
+    std::atomic<bool> m_Running;
+    std::atomic<uint32_t> m_WakeCount;      // Bumped on every command; the thread waits on it
+
+    CSPSCQueue<SSimulationCommand, COMMAND_CAPACITY> m_Commands;
+    CTripleBuffer<SEconomySnapshot> m_Snapshots;
+
+    // Simulation thread only
+    int32_t m_SelectedID;
+    CEconomyProjection m_Projection;
+    SProjectionSeries m_ProjectionSeries;   // Newest finished projection
+    CCompanyTableIndex m_TableIndex;
+
+    // UI thread only: what could not be queued yet (queue full)
+    float m_UnsentGameDelta;
+    bool m_HasUnsentPolicy;
+    SPolicyParams m_UnsentPolicy;
+    bool m_HasUnsentSelection;
+    int32_t m_UnsentSelection;
+    bool m_HasUnsentProjection;
+    SPolicyParams m_UnsentProjectionPolicy;
+    int32_t m_UnsentProjectionMonths;
+    bool m_HasUnsentTableQuery;
+    SCompanyTableQuery m_UnsentTableQuery;
+
+    void Run();
+    void ProcessCommands();
+    bool ApplyCommand(const SSimulationCommand& command);
+    void PublishSnapshot();
+    void WakeUp();
+
+    // UI thread: queue whatever is unsent, in order, and wake the thread
+    void Flush();
+
+public:
+    explicit CSimulationThread(CEconomyManager& economy);
+    ~CSimulationThread();
+
+    CSimulationThread(const CSimulationThread&) = delete;
+    CSimulationThread& operator=(const CSimulationThread&) = delete;
+
+    // Lifecycle (Start publishes the current state before the thread runs).
+    // Start(false) runs no thread and turns on time slicing in the economy.
+    void Start(bool threaded = true);
+    void Stop();
+    bool IsRunning() const { return m_Thread.joinable() || m_Inline; }
+    bool IsThreaded() const { return m_Thread.joinable(); }
+
+    // UI thread, once per frame: without a thread, apply the queued
+    // commands here (within the economy's tick budget). No-op when threaded.
+    void Pump();
+
+    // UI thread: commands (never block; retried next call if the queue is full)
+    void AdvanceTime(float gameDelta);
+    void SetPolicy(const SPolicyParams& policy);
+    void SelectCompany(int32_t companyID);
+    void QueryTable(const SCompanyTableQuery& query);
+
+    // UI thread: project a fork of the economy 'months' ahead under
+    // 'policy' without changing the live one. Replaces a running
+    // projection; the series arrives in a later snapshot (m_Projection).
+    void Project(const SPolicyParams& policy, int32_t months);
+
+    // UI thread: take the newest snapshot (once per frame), then read it
+    // until the next call. Returns true if a new snapshot was taken.
+    bool AcquireSnapshot() { return m_Snapshots.Acquire(); }
+    const SEconomySnapshot& GetSnapshot() const { return m_Snapshots.GetFront(); }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace PoliticSim {
+
+// Running 64-bit hash of simulation state, for determinism checks and
+// replays. Not cryptographic: any change to the hashed bytes changes the
+// value. Long inputs are hashed 32 bytes per step, so hashing every
+// company column each month stays cheap.
+class CStateHash
+{
+public:
+    static constexpr uint64_t INITIAL_VALUE = 0x6A09E667F3BCC908ull;
+    static constexpr uint64_t MULTIPLIER = 0x9FB21C651E98DF25ull;
+    static constexpr int32_t LANE_COUNT = 4;
+    static constexpr size_t LANE_BLOCK_BYTES = LANE_COUNT * sizeof(uint64_t);
+
+private:
+    uint64_t m_Hash;
+
+    void Step(uint64_t word)
+    {
+        m_Hash = std::rotl(m_Hash ^ word, 23) * MULTIPLIER;
+    }
+
+public:
+    CStateHash()
+        : m_Hash(INITIAL_VALUE)
+    {
+    }
+
+    void AddBytes(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t offset = 0;
+
+        // Four independent lanes per 32 bytes keep the multiplier busy on
+        // long columns; they fold back into the running value afterwards
+        if (size >= LANE_BLOCK_BYTES)
+        {
+            uint64_t lanes[LANE_COUNT] = { m_Hash, m_Hash + 1, m_Hash + 2, m_Hash + 3 };
+            for (; offset + LANE_BLOCK_BYTES <= size; offset += LANE_BLOCK_BYTES)
+            {
+                for (int32_t lane = 0; lane < LANE_COUNT; ++lane)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, bytes + offset + lane * sizeof(uint64_t), sizeof(word));
+                    lanes[lane] = std::rotl(lanes[lane] ^ word, 23) * MULTIPLIER;
+                }
+            }
+            for (uint64_t lane : lanes)
+            {
+                Step(lane);
+            }
+        }
+
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes + offset, sizeof(word));
+            Step(word);
+        }
+
+        // Tail bytes, then the length so that trailing zeros still count
+        uint64_t tail = 0;
+        std::memcpy(&tail, bytes + offset, size - offset);
+        Step(tail);
+        Step(size);
+    }
+
+    // T must have no padding (its bytes are hashed as they are)
+    template <typename T>
+    void Add(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types are hashed as bytes");
+        AddBytes(&value, sizeof(T));
+    }
+
+    // Final value (SplitMix64 finalizer, so nearby states spread out)
+    uint64_t GetValue() const
+    {
+        uint64_t value = m_Hash;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+};
+
+} // namespace PoliticSim
@@ -5,7 +5,7 @@
 namespace PoliticSim {
 
 // Company sectors (simplified set for vertical slice)
-enum class ESector
+enum class ESector : uint8_t
 {
     Agriculture,
     Industry,
@@ -18,7 +18,7 @@ enum class ESector
 };
 
 // Company size categories
-enum class ECompanySize
+enum class ECompanySize : uint8_t
 {
     Micro,      // 0-10 employees
     Small,      // 11-50 employees
@@ -27,7 +27,7 @@ enum class ECompanySize
 };
 
 // Company state for decision making
-enum class ECompanyState
+enum class ECompanyState : uint8_t
 {
     Growing,        // Profitable, expanding
     Stable,         // Maintaining, steady
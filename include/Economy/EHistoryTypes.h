@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Per-company metrics that can be kept in the history ring
+enum class EHistoryMetric : uint8_t
+{
+    Profit,
+    Employees,
+    Liquidity,
+    Revenue,
+
+    // Count of metrics (for array sizing)
+    COUNT = 4
+};
+
+// Storage precision of history samples
+enum class EHistoryPrecision : uint8_t
+{
+    Float32,    // Exact copy of the simulated value
+    Float16     // Half the memory; ~3 significant digits, saturates at +-65504
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include "Economy/ECompanyTypes.h"
+
+namespace PoliticSim {
+
+// One aggregate cluster of similar firms (sector x size x formality group)
+struct SClusterConfig
+{
+    ESector m_Sector;
+    ECompanySize m_Size;
+    float m_FormalityLevel;        // Default: 0.3f (0-1, initial mean formality)
+    int64_t m_Population;          // Default: 1000000 (firms represented)
+    int32_t m_Region;              // Default: 0 (leaf region index)
+
+    SClusterConfig()
+        : m_Sector(ESector::Services)
+        , m_Size(ECompanySize::Micro)
+        , m_FormalityLevel(0.3f)
+        , m_Population(1000000)
+        , m_Region(0)
+    {
+    }
+
+    SClusterConfig(ESector sector, ECompanySize size, float formalityLevel, int64_t population, int32_t region = 0)
+        : m_Sector(sector)
+        , m_Size(size)
+        , m_FormalityLevel(formalityLevel)
+        , m_Population(population)
+        , m_Region(region)
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include "Economy/ECompanyTypes.h"
+
+namespace PoliticSim {
+
+// Totals over a range of companies (partial result of the macro reduction).
+// Sums are kept in double so they stay exact enough at millions of companies.
+// Counts are firms represented (sum of sampling weights), not rows.
+struct SCompanyAggregates
+{
+    double m_CompanyCount;
+    double m_TotalEmployees;
+    double m_TotalRevenue;
+    double m_TotalProfit;
+    double m_TotalWages;
+
+    // Index corresponds to ESector enum
+    double m_SectorCompanyCount[static_cast<int32_t>(ESector::COUNT)];
+    double m_SectorRevenue[static_cast<int32_t>(ESector::COUNT)];
+
+    SCompanyAggregates()
+        : m_CompanyCount(0.0)
+        , m_TotalEmployees(0.0)
+        , m_TotalRevenue(0.0)
+        , m_TotalProfit(0.0)
+        , m_TotalWages(0.0)
+        , m_SectorCompanyCount{0.0, 0.0, 0.0, 0.0, 0.0}
+        , m_SectorRevenue{0.0, 0.0, 0.0, 0.0, 0.0}
+    {
+    }
+
+    // Fold another partial into this one
+    void Merge(const SCompanyAggregates& other)
+    {
+        m_CompanyCount += other.m_CompanyCount;
+        m_TotalEmployees += other.m_TotalEmployees;
+        m_TotalRevenue += other.m_TotalRevenue;
+        m_TotalProfit += other.m_TotalProfit;
+        m_TotalWages += other.m_TotalWages;
+
+        for (int32_t i = 0; i < static_cast<int32_t>(ESector::COUNT); ++i)
+        {
+            m_SectorCompanyCount[i] += other.m_SectorCompanyCount[i];
+            m_SectorRevenue[i] += other.m_SectorRevenue[i];
+        }
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Columns of the UI's company table, in display order
+enum class ECompanyTableColumn : uint8_t
+{
+    ID,
+    Sector,
+    Size,
+    Employees,
+    Profit,
+    Liquidity,
+    State,
+
+    // Count of columns (for iteration)
+    COUNT = 7
+};
+
+// Sort order and filters of the company table. Masks have one bit per
+// ESector / ECompanySize / ECompanyState value; a company is listed if all
+// three of its bits are set.
+struct SCompanyTableQuery
+{
+    static constexpr uint32_t ALL = 0xFFFFFFFFu;
+
+    ECompanyTableColumn m_SortColumn;   // Default: ID
+    bool m_Descending;                  // Default: false
+    uint32_t m_SectorMask;              // Default: ALL
+    uint32_t m_SizeMask;                // Default: ALL
+    uint32_t m_StateMask;               // Default: ALL
+
+    SCompanyTableQuery()
+        : m_SortColumn(ECompanyTableColumn::ID)
+        , m_Descending(false)
+        , m_SectorMask(ALL)
+        , m_SizeMask(ALL)
+        , m_StateMask(ALL)
+    {
+    }
+
+    bool operator==(const SCompanyTableQuery& other) const = default;
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Economy/SHistoryConfig.h"
+#include "Economy/SClusterConfig.h"
+#include "Economy/SSamplingConfig.h"
+#include "Economy/SLODConfig.h"
+#include "Economy/SFirmDynamicsConfig.h"
+#include "Economy/SRegionConfig.h"
+#include "Random/CCounterRNG.h"
+
+namespace PoliticSim {
+
+// Startup parameters of the economy (fixed for the lifetime of a world)
+struct SEconomyConfig
+{
+    uint64_t m_WorldSeed;           // Default: CCounterRNG::DEFAULT_WORLD_SEED
+    int32_t m_CompanyCount;         // Default: 250 (companies created at startup)
+    int32_t m_ExpectationMonths;    // Default: 24 (window of smoothed profit)
+    size_t m_WorkerThreads;         // Default: 0 (one per hardware core)
+    SHistoryConfig m_History;
+    std::vector<SClusterConfig> m_Clusters; // Default: empty (individual companies only)
+    SSamplingConfig m_Sampling;
+    SLODConfig m_LOD;
+    SFirmDynamicsConfig m_FirmDynamics;
+    std::vector<SRegionConfig> m_Regions;   // Default: empty (one national region)
+
+    SEconomyConfig()
+        : m_WorldSeed(CCounterRNG::DEFAULT_WORLD_SEED)
+        , m_CompanyCount(250)
+        , m_ExpectationMonths(24)
+        , m_WorkerThreads(0)
+        , m_History()
+        , m_Clusters()
+        , m_Sampling()
+        , m_LOD()
+        , m_FirmDynamics()
+        , m_Regions()
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Economy/ECompanyTypes.h"
+#include "Economy/EHistoryTypes.h"
+#include "Economy/SCompanyAttributes.h"
+#include "Economy/SCompanyState.h"
+#include "Economy/SCompanyTableQuery.h"
+#include "Economy/SMacroState.h"
+#include "Economy/SPolicyParams.h"
+#include "Economy/SProjectionSeries.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoliticSim {
+
+// Immutable copy of the economy after one tick, published by the
+// simulation thread for the UI. Company columns hold one entry per open firm.
+struct SEconomySnapshot
+{
+    static constexpr int32_t METRIC_COUNT = static_cast<int32_t>(EHistoryMetric::COUNT);
+
+    uint32_t m_Tick;                    // Default: 0 (months simulated)
+    int32_t m_PendingMonths;            // Default: 0 (months owed, not yet simulated)
+    SMacroState m_MacroState;
+    SPolicyParams m_PolicyParams;       // Policy the last tick ran with
+
+    // Aggregates
+    double m_RepresentedCompanies;      // Default: 0.0
+    float m_TotalEmployment;            // Default: 0.0f
+    float m_TotalGDP;                   // Default: 0.0f
+    float m_AverageProfitability;       // Default: 0.0f
+
+    // Newest finished what-if projection (m_Generation 0 = none yet)
+    SProjectionSeries m_Projection;
+
+    // Company table columns (open firms only)
+    std::vector<uint32_t> m_IDs;
+    std::vector<ESector> m_Sectors;
+    std::vector<ECompanySize> m_Sizes;
+    std::vector<int32_t> m_Employees;
+    std::vector<float> m_Profitability;
+    std::vector<float> m_Liquidity;
+    std::vector<ECompanyState> m_States;
+
+    // Table order: the column rows m_TableQuery lists, sorted (see
+    // CCompanyTableIndex)
+    SCompanyTableQuery m_TableQuery;
+    std::vector<uint32_t> m_TableRows;
+
+    // Selected company detail (m_SelectedFound is false when the ID is
+    // not in the store, e.g. after a level-of-detail demotion or closure)
+    int32_t m_SelectedID;               // Default: -1 (none)
+    bool m_SelectedFound;               // Default: false
+    SCompanyAttributes m_SelectedAttributes;
+    SCompanyState m_SelectedState;
+    int32_t m_HistoryMonths;            // Default: 0
+    bool m_HistoryRecorded[METRIC_COUNT];
+    std::vector<float> m_History[METRIC_COUNT];  // Oldest to newest
+
+    SEconomySnapshot()
+        : m_Tick(0)
+        , m_PendingMonths(0)
+        , m_MacroState()
+        , m_PolicyParams()
+        , m_RepresentedCompanies(0.0)
+        , m_TotalEmployment(0.0f)
+        , m_TotalGDP(0.0f)
+        , m_AverageProfitability(0.0f)
+        , m_Projection()
+        , m_TableQuery()
+        , m_SelectedID(-1)
+        , m_SelectedFound(false)
+        , m_SelectedAttributes()
+        , m_SelectedState()
+        , m_HistoryMonths(0)
+        , m_HistoryRecorded{}
+    {
+    }
+
+    size_t GetCompanyCount() const { return m_IDs.size(); }
+};
+
+} // namespace PoliticSim
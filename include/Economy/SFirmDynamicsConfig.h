@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Birth and death of individual companies (design doc section 16).
+// Each month, bankrupt firms close and others close at their size's normal
+// turnover rate. As many firms enter each region as left it; profit margin
+// against the economy's and sector saturation against the region's mean
+// decide which sector x size groups they join. Closed rows are reused by
+// entrants of their region, and the rows still empty are compacted away
+// every m_CompactionInterval months, or sooner once they are over a quarter
+// of all rows.
+struct SFirmDynamicsConfig
+{
+    bool m_Enabled;                 // Default: true
+    int32_t m_CompactionInterval;   // Default: 12 (months between compactions of closed rows)
+
+    SFirmDynamicsConfig()
+        : m_Enabled(true)
+        , m_CompactionInterval(12)
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include "Economy/EHistoryTypes.h"
+
+namespace PoliticSim {
+
+// History ring layout (chosen once at startup)
+struct SHistoryConfig
+{
+    static constexpr uint32_t ALL_METRICS = (1u << static_cast<uint32_t>(EHistoryMetric::COUNT)) - 1u;
+
+    int32_t m_Depth;                // Default: 24 (months kept per company)
+    uint32_t m_MetricMask;          // Default: ALL_METRICS (bit per EHistoryMetric)
+    EHistoryPrecision m_Precision;  // Default: Float32
+
+    SHistoryConfig()
+        : m_Depth(24)
+        , m_MetricMask(ALL_METRICS)
+        , m_Precision(EHistoryPrecision::Float32)
+    {
+    }
+
+    static constexpr uint32_t MetricBit(EHistoryMetric metric)
+    {
+        return 1u << static_cast<uint32_t>(metric);
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Dynamic level of detail (design doc "Dynamic Level-of-Detail").
+// Importance = employee weight x log10(1 + employees)
+//            + crisis weight (if in crisis)
+//            + growth weight x |profit trend| (capped at 2)
+// Bankrupt firms (no employees) score 0.
+struct SLODConfig
+{
+    int32_t m_ReviewInterval;       // Default: 0 (months between reviews, 0 = off)
+    int32_t m_FullAgentBudget;      // Default: 1000 (companies simulated at weight 1)
+    float m_PromoteThreshold;       // Default: 3.0 (sampled companies above may displace a full agent)
+    float m_DemoteThreshold;        // Default: 1.5 (full agents below may be displaced)
+    float m_EmployeeWeight;         // Default: 1.0 (per decade of employees)
+    float m_CrisisWeight;           // Default: 1.5
+    float m_GrowthWeight;           // Default: 1.0
+
+    SLODConfig()
+        : m_ReviewInterval(0)
+        , m_FullAgentBudget(1000)
+        , m_PromoteThreshold(3.0f)
+        , m_DemoteThreshold(1.5f)
+        , m_EmployeeWeight(1.0f)
+        , m_CrisisWeight(1.5f)
+        , m_GrowthWeight(1.0f)
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Economy/SPolicyParams.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace PoliticSim {
+
+// Series of an SProjectionSeries, in declaration order
+enum class EProjectionMetric : uint8_t
+{
+    GDP,
+    Employment,
+    UnemploymentRate,
+    AverageProfitability,
+    BusinessConfidence,
+
+    // Count of metrics (for iteration)
+    COUNT = 5
+};
+
+// Macro time series of a what-if projection (see CEconomyProjection), one
+// entry per projected month, oldest first
+struct SProjectionSeries
+{
+    uint32_t m_StartTick;               // Default: 0 (month the fork was taken at)
+    uint32_t m_Generation;              // Default: 0 (bumped for every finished projection)
+    SPolicyParams m_Policy;             // Policy the projection assumed
+
+    std::vector<float> m_GDP;
+    std::vector<float> m_Employment;
+    std::vector<float> m_UnemploymentRate;
+    std::vector<float> m_AverageProfitability;
+    std::vector<float> m_BusinessConfidence;
+
+    SProjectionSeries()
+        : m_StartTick(0)
+        , m_Generation(0)
+        , m_Policy()
+    {
+    }
+
+    size_t GetMonthCount() const { return m_GDP.size(); }
+
+    const std::vector<float>& GetMetric(EProjectionMetric metric) const
+    {
+        switch (metric)
+        {
+            case EProjectionMetric::GDP:                  return m_GDP;
+            case EProjectionMetric::Employment:           return m_Employment;
+            case EProjectionMetric::UnemploymentRate:     return m_UnemploymentRate;
+            case EProjectionMetric::AverageProfitability: return m_AverageProfitability;
+            case EProjectionMetric::BusinessConfidence:   return m_BusinessConfidence;
+            case EProjectionMetric::COUNT:                break;
+        }
+        return m_GDP;
+    }
+};
+
+} // namespace PoliticSim
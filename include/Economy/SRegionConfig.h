@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace PoliticSim {
+
+// One region of the region hierarchy (design doc section 6). Regions
+// without children are leaves: they own companies and clusters and get
+// their own regional macro state.
+struct SRegionConfig
+{
+    std::string m_Name;
+    int32_t m_Parent;              // Default: -1 (directly under the nation; else a lower region index)
+    float m_CompanyShare;          // Default: 1.0f (relative share of companies, leaves only)
+
+    SRegionConfig()
+        : m_Name()
+        , m_Parent(-1)
+        , m_CompanyShare(1.0f)
+    {
+    }
+
+    SRegionConfig(const std::string& name, int32_t parent, float companyShare)
+        : m_Name(name)
+        , m_Parent(parent)
+        , m_CompanyShare(companyShare)
+    {
+    }
+};
+
+} // namespace PoliticSim
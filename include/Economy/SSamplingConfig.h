@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Sampling tier: simulate SEconomyConfig::m_CompanyCount companies as a
+// weighted sample of a larger modeled economy (design doc 4.1, tiers 2/3)
+struct SSamplingConfig
+{
+    int64_t m_RepresentedCompanies; // Default: 0 (no sampling, every company has weight 1)
+    int32_t m_MinimumPerStratum;    // Default: 4 (companies simulated in every non-empty stratum)
+
+    SSamplingConfig()
+        : m_RepresentedCompanies(0)
+        , m_MinimumPerStratum(4)
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Identifies one monthly tick of one world (keys the counter-based RNG)
+struct SSimulationTick
+{
+    uint64_t m_WorldSeed;   // Fixed for the lifetime of a world
+    uint32_t m_Tick;        // Months simulated so far
+
+    SSimulationTick()
+        : m_WorldSeed(0)
+        , m_Tick(0)
+    {
+    }
+
+    SSimulationTick(uint64_t worldSeed, uint32_t tick)
+        : m_WorldSeed(worldSeed)
+        , m_Tick(tick)
+    {
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Independent random streams; each system draws from its own so adding a
+// draw in one place never shifts the numbers seen elsewhere
+enum class ERandomStream : uint32_t
+{
+    Initialization,     // Sector/size of initial companies
+    Reinvestment,       // Growing companies' reinvestment roll
+    ClusterDynamics,    // Entry/exit counts of aggregate clusters
+    FirmExit,           // Companies' monthly closure roll
+    FirmEntry,          // Entrant counts of each region's strata
+    CompanyName         // Display names (keyed by company ID alone)
+};
+
+// Stateless counter-based generator (Philox4x32-10).
+// Output is a pure function of (world seed, entity, tick, stream, index),
+// so draws are reproducible and can be made in any order or on any thread.
+class CCounterRNG
+{
+public:
+    using Block = std::array<uint32_t, 4>;
+
+    static constexpr uint64_t DEFAULT_WORLD_SEED = 0x5EED0F5A1A2D0001ull;
+
+    // Philox4x32 multipliers, Weyl key increments and round count
+    static constexpr uint32_t PHILOX_M0 = 0xD2511F53u;
+    static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57u;
+    static constexpr uint32_t PHILOX_W0 = 0x9E3779B9u;
+    static constexpr uint32_t PHILOX_W1 = 0xBB67AE85u;
+    static constexpr int32_t PHILOX_ROUNDS = 10;
+
+    // Four 32-bit words for one counter
+    static constexpr Block Generate(uint64_t worldSeed, uint32_t entity, uint32_t tick,
+                                    ERandomStream stream, uint32_t index = 0)
+    {
+        uint32_t c0 = entity;
+        uint32_t c1 = tick;
+        uint32_t c2 = static_cast<uint32_t>(stream);
+        uint32_t c3 = index;
+        uint32_t k0 = static_cast<uint32_t>(worldSeed);
+        uint32_t k1 = static_cast<uint32_t>(worldSeed >> 32);
+
+        for (int32_t round = 0; round < PHILOX_ROUNDS; ++round)
+        {
+            uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * c0;
+            uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * c2;
+            uint32_t hi0 = static_cast<uint32_t>(product0 >> 32);
+            uint32_t lo0 = static_cast<uint32_t>(product0);
+            uint32_t hi1 = static_cast<uint32_t>(product1 >> 32);
+            uint32_t lo1 = static_cast<uint32_t>(product1);
+
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        return Block{ c0, c1, c2, c3 };
+    }
+
+    // First word only (the common single-draw case)
+    static constexpr uint32_t Next32(uint64_t worldSeed, uint32_t entity, uint32_t tick,
+                                     ERandomStream stream, uint32_t index = 0)
+    {
+        return Generate(worldSeed, entity, tick, stream, index)[0];
+    }
+
+    // Batch form: out[i] = Next32(worldSeed, entities[i], tick, stream, index).
+    // Uses SSE2/AVX2 lanes when available; results match the scalar form.
+    static void Next32Batch(uint64_t worldSeed, const uint32_t* entities, size_t count,
+                            uint32_t tick, ERandomStream stream, uint32_t* out, uint32_t index = 0);
+
+    // Conversions
+    static constexpr float ToUnitFloat(uint32_t bits)
+    {
+        // 24 high bits -> [0, 1)
+        return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+    }
+
+    static constexpr uint32_t ToRange(uint32_t bits, uint32_t range)
+    {
+        // Multiply-shift mapping to [0, range)
+        return static_cast<uint32_t>((static_cast<uint64_t>(bits) * range) >> 32);
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Economy/SEconomyConfig.h"
+#include "Economy/SPolicyParams.h"
+
+namespace PoliticSim {
+
+class CSaveWriter;
+class CSaveReader;
+
+// World recipe and policy inside an open chunk, shared by economy saves
+// and policy journals. Written field by field: both structs have padding.
+// The worker thread count is not saved; Read leaves it untouched.
+class CConfigChunks
+{
+public:
+    static void WriteConfig(CSaveWriter& writer, const SEconomyConfig& config);
+    static void ReadConfig(CSaveReader& reader, SEconomyConfig& config);
+
+    static void WritePolicy(CSaveWriter& writer, const SPolicyParams& policy);
+    static void ReadPolicy(CSaveReader& reader, SPolicyParams& policy);
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Save/SSaveFormat.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace PoliticSim {
+
+// Reads an economy save file written by CSaveWriter. The file is memory
+// mapped where the platform allows (read into one buffer elsewhere), and
+// arrays are returned as pointers into it: no per-element parsing. Chunks
+// are read in the order they were written. Errors are sticky: reads after
+// a failure return zeros, so callers check IsGood() once per section.
+class CSaveReader
+{
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Offset;            // Next chunk header
+
+    // Open chunk payload
+    size_t m_PayloadBegin;
+    size_t m_PayloadEnd;
+    size_t m_Cursor;
+    bool m_InChunk;
+    bool m_Good;
+
+    std::string m_Path;
+    void* m_Mapping;
+    size_t m_MappingSize;
+    std::vector<uint8_t> m_Buffer;  // Fallback when the file cannot be mapped
+
+    bool MapFile(const std::string& path);
+    const uint8_t* ReadBytes(size_t size);
+
+public:
+    CSaveReader();
+    ~CSaveReader();
+
+    CSaveReader(const CSaveReader&) = delete;
+    CSaveReader& operator=(const CSaveReader&) = delete;
+
+    // Map the file and check the header (magic, version, byte order)
+    bool Open(const std::string& path);
+    void Close();
+    bool IsGood() const { return m_Good; }
+
+    // Report a problem with the file (once) and fail every later read
+    void Fail(const std::string& message);
+
+    // Enter the next chunk, which must have this tag
+    bool BeginChunk(uint32_t tag);
+    void EndChunk();
+
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types are saved as bytes");
+        T value{};
+        if (const uint8_t* bytes = ReadBytes(sizeof(T)))
+        {
+            std::memcpy(&value, bytes, sizeof(T));
+        }
+        return value;
+    }
+    template <typename T>
+    void Read(T& value) { value = Read<T>(); }
+    std::string ReadString();
+
+    // Pointer to 'count' values inside the mapped file (nullptr on error)
+    template <typename T>
+    const T* ReadArray(size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types are saved as bytes");
+        if (count > (m_Size / sizeof(T)) + 1)
+        {
+            Fail("array too large");
+            return nullptr;
+        }
+        return reinterpret_cast<const T*>(ReadBytes(count * sizeof(T)));
+    }
+
+    // A chunk holding exactly one array of 'count' values
+    template <typename T>
+    const T* ReadColumn(uint32_t tag, size_t count)
+    {
+        if (!BeginChunk(tag))
+        {
+            return nullptr;
+        }
+        const T* values = ReadArray<T>(count);
+        EndChunk();
+        return values;
+    }
+
+    // Copy a column into a vector (one bulk copy)
+    template <typename T>
+    bool ReadColumn(uint32_t tag, size_t count, std::vector<T>& out)
+    {
+        const T* values = ReadColumn<T>(tag, count);
+        if (values == nullptr && count > 0)
+        {
+            return false;
+        }
+        out.assign(values, values + count);
+        return m_Good;
+    }
+};
+
+} // namespace PoliticSim
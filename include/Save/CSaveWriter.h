@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Save/SSaveFormat.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+namespace PoliticSim {
+
+// Writes an economy save file chunk by chunk (see SSaveFormat).
+// Errors are sticky: check Close() (or IsGood()) once at the end.
+class CSaveWriter
+{
+private:
+    std::ofstream m_File;
+    std::string m_Path;
+    uint64_t m_Offset;          // Bytes written so far
+    uint64_t m_ChunkStart;      // Offset of the open chunk's header
+    bool m_InChunk;
+    bool m_Good;
+
+    void WriteBytes(const void* data, size_t size);
+    void Pad(uint64_t offset);
+
+public:
+    CSaveWriter();
+    ~CSaveWriter() = default;
+
+    // Create the file and write the header chunk
+    bool Open(const std::string& path);
+    bool Close();
+    bool IsGood() const { return m_Good; }
+
+    void BeginChunk(uint32_t tag);
+    void EndChunk();
+
+    // Fixed-layout values inside the open chunk. T must have no padding:
+    // padding bytes are indeterminate, so saves of one state would differ.
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types are saved as bytes");
+        WriteBytes(&value, sizeof(T));
+    }
+    void WriteString(const std::string& text);
+
+    // Array inside the open chunk. The first array of a chunk starts on a
+    // CHUNK_ALIGNMENT boundary, so it can be used in place once mapped.
+    template <typename T>
+    void WriteArray(const T* values, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types are saved as bytes");
+        WriteBytes(values, count * sizeof(T));
+    }
+
+    // A chunk holding exactly one array
+    template <typename T>
+    void WriteColumn(uint32_t tag, const T* values, size_t count)
+    {
+        BeginChunk(tag);
+        WriteArray(values, count);
+        EndChunk();
+    }
+};
+
+} // namespace PoliticSim
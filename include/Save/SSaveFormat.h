@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Layout of economy save files (little-endian, fixed-width fields).
+//
+//   [header chunk] [chunk] [chunk] ...
+//
+// Every chunk is a CHUNK_ALIGNMENT-byte header (tag, payload size) followed
+// by its payload, which starts on a CHUNK_ALIGNMENT boundary. Column chunks
+// hold one array each, so a mapped file can be read in place. Structs are
+// written as their in-memory bytes; any change to a saved struct or to the
+// chunk order bumps FORMAT_VERSION.
+struct SSaveFormat
+{
+    static constexpr uint32_t FORMAT_VERSION = 3;
+    static constexpr size_t CHUNK_ALIGNMENT = 64;
+    static constexpr uint32_t ENDIAN_CHECK = 0x01020304u;
+    static constexpr char MAGIC[8] = { 'P', 'S', 'I', 'M', 'S', 'A', 'V', 'E' };
+
+    // Four-character chunk tags ("ECON" reads as ECON in a hex dump)
+    static constexpr uint32_t MakeTag(const char (&name)[5])
+    {
+        return static_cast<uint32_t>(static_cast<uint8_t>(name[0]))
+             | static_cast<uint32_t>(static_cast<uint8_t>(name[1])) << 8
+             | static_cast<uint32_t>(static_cast<uint8_t>(name[2])) << 16
+             | static_cast<uint32_t>(static_cast<uint8_t>(name[3])) << 24;
+    }
+
+    static constexpr size_t AlignUp(size_t offset)
+    {
+        return (offset + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1);
+    }
+};
+
+// Header of every chunk (padded to CHUNK_ALIGNMENT in the file)
+struct SSaveChunkHeader
+{
+    uint32_t m_Tag;
+    uint32_t m_Reserved;
+    uint64_t m_PayloadSize;
+};
+
+} // namespace PoliticSim
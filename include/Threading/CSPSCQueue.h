@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace PoliticSim {
+
+// Bounded lock-free single-producer/single-consumer ring buffer.
+// Capacity must be a power of two; one push and one pop may run
+// concurrently from two different threads.
+template <typename T, size_t Capacity>
+class CSPSCQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    T m_Items[Capacity];
+    std::atomic<size_t> m_Head;     // Next slot to pop (written by the consumer)
+    std::atomic<size_t> m_Tail;     // Next slot to push (written by the producer)
+
+public:
+    CSPSCQueue()
+        : m_Head(0)
+        , m_Tail(0)
+    {
+    }
+
+    CSPSCQueue(const CSPSCQueue&) = delete;
+    CSPSCQueue& operator=(const CSPSCQueue&) = delete;
+
+    // Producer. Returns false when the queue is full.
+    bool TryPush(const T& item)
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+        m_Items[tail & (Capacity - 1)] = item;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer. Returns false when the queue is empty.
+    bool TryPop(T& item)
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_Tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        item = m_Items[head & (Capacity - 1)];
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+} // namespace PoliticSim
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace PoliticSim {
+
+// Lock-free single-producer/single-consumer triple buffer.
+// The producer fills GetBack() and publishes it; the consumer acquires the
+// newest published value and reads GetFront() until its next Acquire. Each
+// side owns one slot and they trade through the middle slot, so neither
+// side ever waits and the consumer never sees a half-written value.
+template <typename T>
+class CTripleBuffer
+{
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH_BIT = 0x4;   // Middle holds an unread value
+
+    T m_Slots[3];
+    std::atomic<uint8_t> m_Middle;
+    uint8_t m_Back;                             // Producer only
+    uint8_t m_Front;                            // Consumer only
+
+public:
+    CTripleBuffer()
+        : m_Middle(1)
+        , m_Back(0)
+        , m_Front(2)
+    {
+    }
+
+    CTripleBuffer(const CTripleBuffer&) = delete;
+    CTripleBuffer& operator=(const CTripleBuffer&) = delete;
+
+    // Producer: slot to write (may hold an older value; overwrite it fully)
+    T& GetBack() { return m_Slots[m_Back]; }
+
+    // Producer: make the back slot the newest value
+    void Publish()
+    {
+        uint8_t previous = m_Middle.exchange(static_cast<uint8_t>(m_Back | FRESH_BIT), std::memory_order_acq_rel);
+        m_Back = previous & INDEX_MASK;
+    }
+
+    // Consumer: take the newest value if one was published since the last
+    // call. Returns false (and keeps the current front) otherwise.
+    bool Acquire()
+    {
+        if ((m_Middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+        {
+            return false;
+        }
+        uint8_t previous = m_Middle.exchange(m_Front, std::memory_order_acq_rel);
+        m_Front = previous & INDEX_MASK;
+        return true;
+    }
+
+    // Consumer: value taken by the last Acquire
+    const T& GetFront() const { return m_Slots[m_Front]; }
+};
+
+} // namespace PoliticSim
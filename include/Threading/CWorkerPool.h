@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PoliticSim {
+
+// Fixed-size pool of worker threads for data-parallel loops.
+// The calling thread takes part in every ParallelFor, so a pool of N
+// threads spawns N-1 workers.
+class CWorkerPool
+{
+public:
+    using RangeTask = std::function<void(size_t begin, size_t end)>;
+
+private:
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkAvailable;
+    std::condition_variable m_WorkDone;
+
+    // Current job (valid while m_ActiveWorkers > 0)
+    const RangeTask* m_Task;
+    size_t m_Count;
+    size_t m_GrainSize;
+    size_t m_ChunkCount;
+    std::atomic<size_t> m_NextChunk;
+    size_t m_ActiveWorkers;
+    uint64_t m_JobGeneration;
+    bool m_Stopping;
+
+    void WorkerLoop();
+    void RunChunks();
+
+public:
+    explicit CWorkerPool(size_t threadCount);
+    ~CWorkerPool();
+
+    CWorkerPool(const CWorkerPool&) = delete;
+    CWorkerPool& operator=(const CWorkerPool&) = delete;
+
+    // Split [0, count) into chunks of grainSize and run them on all threads.
+    // Chunk boundaries depend only on count and grainSize, never on the
+    // number of threads. Blocks until every chunk has finished.
+    void ParallelFor(size_t count, size_t grainSize, const RangeTask& task);
+
+    size_t GetThreadCount() const { return m_Workers.size() + 1; }
+
+    // Hardware concurrency, at least 1
+    static size_t GetDefaultThreadCount();
+};
+
+} // namespace PoliticSim
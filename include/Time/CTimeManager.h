@@ -52,6 +52,10 @@ public:
     float ConvertRealToGameTime(float realSeconds) const;
     float ConvertGameToRealTime(float gameSeconds) const;
 
+    // Real seconds left at the current speed until the next monthly tick is
+    // due (0 while paused). Time-sliced ticks spread their work over it.
+    float GetRealTimeToNextMonth() const;
+
     // Statistics
     float GetTotalRealTime() const { return m_TotalRealTime; }
     uint32_t GetFrameCount() const { return m_FrameCount; }
@@ -5,6 +5,7 @@
 #include <Engine/Core/Camera/CameraFollowGO.h>
 #include "Time/CTimeManager.h"
 #include "Economy/CEconomyManager.h"
+#include "Economy/CSimulationThread.h"
 #include <memory>
 
 namespace PoliticSim {
@@ -19,11 +20,21 @@ private:
 	std::unique_ptr<CCameraFollowGO> m_Camera;
 	std::unique_ptr<CTimeManager> m_TimeManager;
 	std::unique_ptr<CEconomyManager> m_EconomyManager;
+	std::unique_ptr<CSimulationThread> m_Simulation;	// Runs m_EconomyManager; the UI reads its snapshots
+	SPolicyParams m_PolicyDraft;						// Policy being edited in the UI
+	bool m_PreviewPolicy;								// Draft changes are projected, not applied
+	int32_t m_ProjectionMonths;
 	const bool* m_KeyboardState;
 
 	int32_t m_SelectedCompanyID;
+	SCompanyTableQuery m_TableQuery;					// Company table sort and filters (last sent)
 
 	static constexpr float CAMERA_SPEED = 200.0f;
+	static constexpr int32_t DEFAULT_PROJECTION_MONTHS = 24;
+
+	// Journal of the session's policy changes, written on exit (replay it
+	// with politicsim-headless --replay)
+	static constexpr const char* SESSION_JOURNAL_PATH = "politicsim_session.journal";
 
 	// Helper methods
 	void HandleDiscreteInput(const SDL_Event& event);
@@ -31,7 +42,7 @@ private:
 	void UpdateCameraMovement(float deltaTime);
 
 public:
-	CPoliticalGame() : m_SelectedCompanyID(-1) {}
+	CPoliticalGame() : m_PreviewPolicy(false), m_ProjectionMonths(DEFAULT_PROJECTION_MONTHS), m_SelectedCompanyID(-1), m_TableQuery() {}
 	virtual ~CPoliticalGame() = default;
 
 	// IApplication implementation
@@ -46,6 +57,7 @@ public:
 	CWorld* GetWorld() const { return m_World.get(); }
 	CTimeManager* GetTimeManager() const { return m_TimeManager.get(); }
 	CEconomyManager* GetEconomyManager() const { return m_EconomyManager.get(); }
+	CSimulationThread* GetSimulation() const { return m_Simulation.get(); }
 };
 
 } // namespace PoliticSim
@@ -0,0 +1,380 @@
+#include "Economy/CEconomyManager.h"
+#include "Economy/SEconomyConfig.h"
+#include "Threading/CWorkerPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace PoliticSim;
+
+namespace {
+
+struct SBenchOptions
+{
+    std::vector<int32_t> m_Scales;      // Default: 250, 10K, 100K, 1M, 10M companies
+    std::vector<size_t> m_ThreadCounts; // Default: 1, 2, 4, ... up to the hardware thread count
+    double m_MinSeconds;                // Default: 0.25 (minimum timed duration per measurement)
+    uint64_t m_WorldSeed;               // Default: CCounterRNG::DEFAULT_WORLD_SEED
+    std::string m_JsonPath;             // Default: empty (no JSON output)
+    std::string m_BaselinePath;         // Default: empty (no comparison)
+    double m_Tolerance;                 // Default: 5.0 (percent slowdown reported as a regression)
+
+    SBenchOptions()
+        : m_Scales{ 250, 10000, 100000, 1000000, 10000000 }
+        , m_ThreadCounts()
+        , m_MinSeconds(0.25)
+        , m_WorldSeed(CCounterRNG::DEFAULT_WORLD_SEED)
+        , m_JsonPath()
+        , m_BaselinePath()
+        , m_Tolerance(5.0)
+    {
+        size_t hardwareThreads = CWorkerPool::GetDefaultThreadCount();
+        for (size_t threads = 1; threads < hardwareThreads; threads *= 2)
+        {
+            m_ThreadCounts.push_back(threads);
+        }
+        m_ThreadCounts.push_back(hardwareThreads);
+    }
+};
+
+struct SBenchResult
+{
+    std::string m_Benchmark;
+    int32_t m_Companies;
+    size_t m_Threads;
+    int32_t m_Iterations;
+    double m_MsPerIteration;        // Median over all iterations
+    double m_NsPerCompany;
+    double m_BytesPerCompany;
+};
+
+void PrintUsage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --scales A,B,...   Company counts (default 250,10000,100000,1000000,10000000)\n"
+              << "  --threads A,B,...  Thread counts (default 1,2,4,... up to hardware threads)\n"
+              << "  --min-time S       Minimum seconds timed per measurement (default 0.25)\n"
+              << "  --seed N           World seed\n"
+              << "  --json FILE        Write results as JSON\n"
+              << "  --baseline FILE    Compare against a JSON file from an earlier --json run\n"
+              << "  --tolerance P      Percent slowdown counted as a regression (default 5)\n";
+}
+
+template <typename T>
+bool ParseList(const char* text, std::vector<T>& values)
+{
+    values.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        char* end = nullptr;
+        unsigned long long value = std::strtoull(item.c_str(), &end, 10);
+        if (end == item.c_str() || *end != '\0' || value == 0)
+        {
+            return false;
+        }
+        values.push_back(static_cast<T>(value));
+    }
+    return !values.empty();
+}
+
+bool ParseArguments(int argc, char* argv[], SBenchOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* argument = argv[i];
+        if (std::strcmp(argument, "--help") == 0 || std::strcmp(argument, "-h") == 0)
+        {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << argument << std::endl;
+            return false;
+        }
+        const char* value = argv[++i];
+        bool valid = true;
+
+        if (std::strcmp(argument, "--scales") == 0)
+            valid = ParseList(value, options.m_Scales);
+        else if (std::strcmp(argument, "--threads") == 0)
+            valid = ParseList(value, options.m_ThreadCounts);
+        else if (std::strcmp(argument, "--min-time") == 0)
+            options.m_MinSeconds = std::atof(value);
+        else if (std::strcmp(argument, "--seed") == 0)
+            options.m_WorldSeed = std::strtoull(value, nullptr, 0);
+        else if (std::strcmp(argument, "--json") == 0)
+            options.m_JsonPath = value;
+        else if (std::strcmp(argument, "--baseline") == 0)
+            options.m_BaselinePath = value;
+        else if (std::strcmp(argument, "--tolerance") == 0)
+            options.m_Tolerance = std::atof(value);
+        else
+        {
+            std::cerr << "Unknown option " << argument << std::endl;
+            return false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << "Invalid list for " << argument << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Runs 'task' at least three times and for at least minSeconds after one
+// warm-up call; returns the median milliseconds per call
+template <typename Task>
+double MeasureMedianMs(double minSeconds, int32_t& iterations, Task&& task)
+{
+    using Clock = std::chrono::steady_clock;
+
+    task();
+
+    std::vector<double> samples;
+    Clock::time_point start = Clock::now();
+    while (samples.size() < 3 || std::chrono::duration<double>(Clock::now() - start).count() < minSeconds)
+    {
+        Clock::time_point begin = Clock::now();
+        task();
+        samples.push_back(std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+    }
+
+    iterations = static_cast<int32_t>(samples.size());
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+SBenchResult MakeResult(const char* benchmark, int32_t companies, size_t threads,
+                        int32_t iterations, double msPerIteration, size_t bytes)
+{
+    SBenchResult result;
+    result.m_Benchmark = benchmark;
+    result.m_Companies = companies;
+    result.m_Threads = threads;
+    result.m_Iterations = iterations;
+    result.m_MsPerIteration = msPerIteration;
+    result.m_NsPerCompany = msPerIteration * 1.0e6 / companies;
+    result.m_BytesPerCompany = static_cast<double>(bytes) / companies;
+    return result;
+}
+
+void PrintResult(const SBenchResult& result, double singleThreadMs)
+{
+    std::printf("%-22s %10d %4zu %12.3f %12.2f %10.1f %8.2fx\n",
+                result.m_Benchmark.c_str(), result.m_Companies, result.m_Threads,
+                result.m_MsPerIteration, result.m_NsPerCompany, result.m_BytesPerCompany,
+                singleThreadMs / result.m_MsPerIteration);
+}
+
+void RunScale(const SBenchOptions& options, int32_t companies, std::vector<SBenchResult>& results)
+{
+    SEconomyConfig config;
+    config.m_WorldSeed = options.m_WorldSeed;
+    config.m_CompanyCount = companies;
+    config.m_WorkerThreads = 1;
+
+    CEconomyManager economy;
+    std::cout.setstate(std::ios::failbit);  // Silence Initialize() logging
+
+    // Company creation is single-threaded
+    int32_t iterations = 0;
+    double initializeMs = MeasureMedianMs(options.m_MinSeconds, iterations,
+        [&economy, &config]() { economy.Initialize(config); });
+    std::cout.clear();
+
+    size_t bytes = economy.GetCompanyStore().GetMemoryBytes();
+    results.push_back(MakeResult("InitializeCompanies", companies, 1, iterations, initializeMs, bytes));
+    PrintResult(results.back(), initializeMs);
+
+    // What-if fork (copy-on-write attributes, bulk copy of the state)
+    double forkMs = MeasureMedianMs(options.m_MinSeconds, iterations,
+        [&economy]() { economy.Fork(); });
+    results.push_back(MakeResult("ForkEconomy", companies, 1, iterations, forkMs, bytes));
+    PrintResult(results.back(), forkMs);
+
+    double simulateSingleMs = 0.0;
+    double aggregateSingleMs = 0.0;
+    for (size_t threads : options.m_ThreadCounts)
+    {
+        economy.SetWorkerThreadCount(threads);
+
+        double simulateMs = MeasureMedianMs(options.m_MinSeconds, iterations,
+            [&economy]() { economy.SimulateAllCompanies(); });
+        if (simulateSingleMs == 0.0)
+        {
+            simulateSingleMs = simulateMs;
+        }
+        results.push_back(MakeResult("SimulateAllCompanies", companies, threads, iterations, simulateMs, bytes));
+        PrintResult(results.back(), simulateSingleMs);
+
+        double aggregateMs = MeasureMedianMs(options.m_MinSeconds, iterations,
+            [&economy]() { economy.UpdateMacroState(); });
+        if (aggregateSingleMs == 0.0)
+        {
+            aggregateSingleMs = aggregateMs;
+        }
+        results.push_back(MakeResult("UpdateMacroState", companies, threads, iterations, aggregateMs, bytes));
+        PrintResult(results.back(), aggregateSingleMs);
+    }
+}
+
+bool WriteJson(const std::string& path, const std::vector<SBenchResult>& results)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cerr << "Cannot write " << path << std::endl;
+        return false;
+    }
+
+    // One result per line, which is also what ReadBaseline() expects
+    file << "{\n  \"version\": 1,\n  \"hardware_threads\": " << CWorkerPool::GetDefaultThreadCount()
+         << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const SBenchResult& result = results[i];
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      "    {\"benchmark\": \"%s\", \"companies\": %d, \"threads\": %zu, \"iterations\": %d, "
+                      "\"ms_per_iteration\": %.6f, \"ns_per_company\": %.4f, \"bytes_per_company\": %.2f}%s\n",
+                      result.m_Benchmark.c_str(), result.m_Companies, result.m_Threads, result.m_Iterations,
+                      result.m_MsPerIteration, result.m_NsPerCompany, result.m_BytesPerCompany,
+                      i + 1 < results.size() ? "," : "");
+        file << line;
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+bool ExtractField(const std::string& line, const char* key, std::string& value)
+{
+    std::string pattern = std::string("\"") + key + "\": ";
+    size_t position = line.find(pattern);
+    if (position == std::string::npos)
+    {
+        return false;
+    }
+    position += pattern.size();
+
+    if (line[position] == '"')
+    {
+        size_t end = line.find('"', position + 1);
+        value = line.substr(position + 1, end - position - 1);
+    }
+    else
+    {
+        size_t end = line.find_first_of(",}", position);
+        value = line.substr(position, end - position);
+    }
+    return true;
+}
+
+bool ReadBaseline(const std::string& path, std::vector<SBenchResult>& results)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "Cannot read baseline " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::string benchmark, companies, threads, nsPerCompany;
+        if (ExtractField(line, "benchmark", benchmark) && ExtractField(line, "companies", companies) &&
+            ExtractField(line, "threads", threads) && ExtractField(line, "ns_per_company", nsPerCompany))
+        {
+            SBenchResult result{};
+            result.m_Benchmark = benchmark;
+            result.m_Companies = std::atoi(companies.c_str());
+            result.m_Threads = static_cast<size_t>(std::strtoull(threads.c_str(), nullptr, 10));
+            result.m_NsPerCompany = std::atof(nsPerCompany.c_str());
+            results.push_back(result);
+        }
+    }
+    return true;
+}
+
+// Prints the change per matching measurement; returns the number of regressions
+int32_t CompareWithBaseline(const std::vector<SBenchResult>& results, const std::vector<SBenchResult>& baseline,
+                            double tolerance)
+{
+    int32_t regressions = 0;
+    std::printf("\n%-22s %10s %4s %12s %12s %9s\n", "baseline", "companies", "thr", "base ns/co", "ns/co", "change");
+
+    for (const SBenchResult& result : results)
+    {
+        for (const SBenchResult& reference : baseline)
+        {
+            if (reference.m_Benchmark != result.m_Benchmark || reference.m_Companies != result.m_Companies ||
+                reference.m_Threads != result.m_Threads || reference.m_NsPerCompany <= 0.0)
+            {
+                continue;
+            }
+
+            double change = (result.m_NsPerCompany / reference.m_NsPerCompany - 1.0) * 100.0;
+            bool regressed = change > tolerance;
+            regressions += regressed ? 1 : 0;
+            std::printf("%-22s %10d %4zu %12.2f %12.2f %+8.1f%%%s\n",
+                        result.m_Benchmark.c_str(), result.m_Companies, result.m_Threads,
+                        reference.m_NsPerCompany, result.m_NsPerCompany, change, regressed ? "  REGRESSION" : "");
+            break;
+        }
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SBenchOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::printf("%-22s %10s %4s %12s %12s %10s %9s\n",
+                "benchmark", "companies", "thr", "ms/iter", "ns/company", "bytes/co", "speedup");
+
+    std::vector<SBenchResult> results;
+    for (int32_t companies : options.m_Scales)
+    {
+        RunScale(options, companies, results);
+    }
+
+    if (!options.m_JsonPath.empty() && !WriteJson(options.m_JsonPath, results))
+    {
+        return 1;
+    }
+
+    if (!options.m_BaselinePath.empty())
+    {
+        std::vector<SBenchResult> baseline;
+        if (!ReadBaseline(options.m_BaselinePath, baseline))
+        {
+            return 1;
+        }
+        if (CompareWithBaseline(results, baseline, options.m_Tolerance) > 0)
+        {
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,488 @@
+#include "Economy/CCompanyCluster.h"
+#include "Economy/CCompanyStore.h"
+#include "Economy/CFirmDynamics.h"
+#include "Economy/CStateHash.h"
+#include "Random/CCounterRNG.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace PoliticSim {
+
+namespace {
+
+// The financial kernel is homogeneous of degree one in (employees, debt),
+// so representatives are evaluated at this multiple of their size and
+// scaled back. Keeps fractional mean employee counts accurate.
+constexpr float KERNEL_SCALE = 1000.0f;
+
+// Initial coefficient of variation of employees and liquidity
+constexpr float INITIAL_SPREAD = 0.5f;
+
+// Three-point Gauss-Hermite rule (exact for polynomials up to degree 5)
+constexpr float REPRESENTATIVE_NODES[CCompanyCluster::REPRESENTATIVE_COUNT] = { -1.7320508f, 0.0f, 1.7320508f };
+constexpr float REPRESENTATIVE_WEIGHTS[CCompanyCluster::REPRESENTATIVE_COUNT] = { 1.0f / 6.0f, 2.0f / 3.0f, 1.0f / 6.0f };
+
+// Share of firms above/below a threshold, assuming a normal distribution
+float ShareBelow(const SClusterMoment& moment, float threshold)
+{
+    if (moment.m_Variance <= 0.0f)
+    {
+        return moment.m_Mean < threshold ? 1.0f : 0.0f;
+    }
+    float z = (threshold - moment.m_Mean) / std::sqrt(moment.m_Variance);
+    return 0.5f * std::erfc(-z * 0.70710678f);
+}
+
+float ShareAbove(const SClusterMoment& moment, float threshold)
+{
+    return 1.0f - ShareBelow(moment, threshold);
+}
+
+// Binomial(trials, probability) via its normal approximation, driven by two
+// 32-bit random words (Box-Muller)
+int64_t DrawBinomial(int64_t trials, float probability, uint32_t bits0, uint32_t bits1)
+{
+    if (trials <= 0 || probability <= 0.0f)
+    {
+        return 0;
+    }
+    probability = std::min(probability, 1.0f);
+
+    double mean = static_cast<double>(trials) * probability;
+    double deviation = std::sqrt(mean * (1.0 - probability));
+
+    double u1 = (static_cast<double>(bits0 >> 8) + 1.0) / 16777217.0;  // (0, 1]
+    double u2 = CCounterRNG::ToUnitFloat(bits1);
+    double z = std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+
+    return std::clamp<int64_t>(std::llround(mean + deviation * z), 0, trials);
+}
+
+// Pool two groups of firms into one distribution
+SClusterMoment Combine(const SClusterMoment& a, double countA, const SClusterMoment& b, double countB)
+{
+    double total = countA + countB;
+    if (total <= 0.0)
+    {
+        return a;
+    }
+
+    double mean = (a.m_Mean * countA + b.m_Mean * countB) / total;
+    double deltaA = a.m_Mean - mean;
+    double deltaB = b.m_Mean - mean;
+    double variance = (countA * (a.m_Variance + deltaA * deltaA) + countB * (b.m_Variance + deltaB * deltaB)) / total;
+    return SClusterMoment(static_cast<float>(mean), static_cast<float>(variance));
+}
+
+} // namespace
+
+CCompanyCluster::CCompanyCluster(uint32_t id, uint16_t region, const SClusterConfig& config,
+                                 const SCompanyAttributes& attributes)
+    : m_ID(id)
+    , m_Region(region)
+    , m_Attributes(attributes)
+    , m_EntrantState(CCompanyStore::MakeInitialState(attributes))
+    , m_Population(std::max<int64_t>(config.m_Population, 0))
+    , m_LastEntries(0)
+    , m_LastExits(0)
+    , m_Revenue(0.0f)
+    , m_Debt(0.0f)
+    , m_WageLevel(0.0f)
+    , m_CapacityUtilization(0.0f)
+    , m_AverageProfit(0.0f)
+{
+    m_EntrantState.m_FormalityLevel = std::clamp(config.m_FormalityLevel, 0.0f, 1.0f);
+
+    float employees = static_cast<float>(m_EntrantState.m_Employees);
+    float liquidity = m_EntrantState.m_Liquidity;
+    m_Employees = SClusterMoment(employees, employees * employees * INITIAL_SPREAD * INITIAL_SPREAD);
+    m_Liquidity = SClusterMoment(liquidity, liquidity * liquidity * INITIAL_SPREAD * INITIAL_SPREAD);
+    m_Profitability = SClusterMoment(m_EntrantState.m_Profitability, 0.0f);
+    m_Formality = SClusterMoment(m_EntrantState.m_FormalityLevel, 0.0f);
+
+    m_Debt = m_EntrantState.m_Debt;
+    m_WageLevel = m_EntrantState.m_WageLevel;
+    m_CapacityUtilization = m_EntrantState.m_CapacityUtilization;
+}
+
+void CCompanyCluster::Simulate(const SFinancialCoefficients& coefficients, const SPolicyParams& policy,
+                               const SMacroState& macro, float expectationSmoothing)
+{
+    if (m_Population == 0)
+    {
+        return;
+    }
+
+    // 1-3. Revenue, costs and liquidity over the distribution
+    UpdateFinancials(coefficients);
+
+    // 4-5. Expectations and the average outcome of the decision rules
+    MakeDecisions(policy, macro, expectationSmoothing);
+}
+
+float CCompanyCluster::GetExitRate() const
+{
+    // Normal turnover plus bankruptcies (same rule as individual firms)
+    float shareBankrupt = ShareBelow(m_Liquidity, CCompanyStore::BANKRUPTCY_LIQUIDITY);
+    return std::min(1.0f, CFirmDynamics::GetMonthlyTurnover(m_Attributes.m_Size) + shareBankrupt);
+}
+
+float CCompanyCluster::GetEntryRate(const SMacroState& macro, float referenceMargin) const
+{
+    // Replaces exit, more when incumbents beat the economy's margin, less in
+    // sectors more saturated than the others
+    float saturation = macro.m_SectorSaturation[static_cast<int32_t>(m_Attributes.m_Sector)];
+    float margin = CFirmDynamics::GetProfitMargin(m_Profitability.m_Mean, m_Revenue);
+    return CFirmDynamics::GetEntryRate(GetExitRate(), margin, referenceMargin, saturation,
+                                       CFirmDynamics::GetMeanSaturation(macro));
+}
+
+void CCompanyCluster::UpdateFinancials(const SFinancialCoefficients& coefficients)
+{
+    int32_t employees[REPRESENTATIVE_COUNT];
+    float productivity[REPRESENTATIVE_COUNT];
+    float capacityUtilization[REPRESENTATIVE_COUNT];
+    float domesticOrientation[REPRESENTATIVE_COUNT];
+    float wageLevel[REPRESENTATIVE_COUNT];
+    float laborIntensity[REPRESENTATIVE_COUNT];
+    float debt[REPRESENTATIVE_COUNT];
+    ESector sectors[REPRESENTATIVE_COUNT];
+    ECompanySize sizes[REPRESENTATIVE_COUNT];
+    float revenue[REPRESENTATIVE_COUNT];
+    float profitability[REPRESENTATIVE_COUNT];
+
+    // Representatives sit at the Gauss-Hermite nodes of the employee distribution
+    float employeeDeviation = std::sqrt(m_Employees.m_Variance);
+    float largest = std::max(1.0f, m_Employees.m_Mean + REPRESENTATIVE_NODES[REPRESENTATIVE_COUNT - 1] * employeeDeviation);
+    float scale = std::min(KERNEL_SCALE, 1.0e9f / largest);
+
+    for (int32_t k = 0; k < REPRESENTATIVE_COUNT; ++k)
+    {
+        float representative = std::max(1.0f, m_Employees.m_Mean + REPRESENTATIVE_NODES[k] * employeeDeviation);
+        employees[k] = static_cast<int32_t>(std::lround(representative * scale));
+        productivity[k] = m_Attributes.m_BaseProductivity;
+        capacityUtilization[k] = m_CapacityUtilization;
+        domesticOrientation[k] = m_Attributes.m_DomesticOrientation;
+        wageLevel[k] = m_WageLevel;
+        laborIntensity[k] = m_Attributes.m_LaborIntensity;
+        debt[k] = m_Debt * scale;
+        sectors[k] = m_Attributes.m_Sector;
+        sizes[k] = m_Attributes.m_Size;
+    }
+
+    SFinancialBatch batch;
+    batch.m_Count = REPRESENTATIVE_COUNT;
+    batch.m_Employees = employees;
+    batch.m_BaseProductivity = productivity;
+    batch.m_CapacityUtilization = capacityUtilization;
+    batch.m_DomesticOrientation = domesticOrientation;
+    batch.m_WageLevel = wageLevel;
+    batch.m_LaborIntensity = laborIntensity;
+    batch.m_Debt = debt;
+    batch.m_Sectors = sectors;
+    batch.m_Sizes = sizes;
+    batch.m_Revenue = revenue;
+    batch.m_Profitability = profitability;
+
+    CCompanyKernels::ComputeFinancials(batch, coefficients);
+
+    float meanRevenue = 0.0f;
+    float meanProfit = 0.0f;
+    for (int32_t k = 0; k < REPRESENTATIVE_COUNT; ++k)
+    {
+        revenue[k] /= scale;
+        profitability[k] /= scale;
+        meanRevenue += REPRESENTATIVE_WEIGHTS[k] * revenue[k];
+        meanProfit += REPRESENTATIVE_WEIGHTS[k] * profitability[k];
+    }
+
+    float profitVariance = 0.0f;
+    for (int32_t k = 0; k < REPRESENTATIVE_COUNT; ++k)
+    {
+        float delta = profitability[k] - meanProfit;
+        profitVariance += REPRESENTATIVE_WEIGHTS[k] * delta * delta;
+    }
+
+    m_Revenue = meanRevenue;
+    m_Profitability = SClusterMoment(meanProfit, profitVariance);
+
+    // Profit accrues to liquidity firm by firm
+    m_Liquidity.m_Mean += meanProfit;
+    m_Liquidity.m_Variance += profitVariance;
+}
+
+void CCompanyCluster::MakeDecisions(const SPolicyParams& policy, const SMacroState& macro, float expectationSmoothing)
+{
+    // Expectations of the mean firm (same rule as CCompanyStore::UpdateExpectations)
+    float profitability = m_Profitability.m_Mean;
+    m_AverageProfit += expectationSmoothing * (profitability - m_AverageProfit);
+    float trend = (profitability - m_AverageProfit) / (std::abs(m_AverageProfit) + 0.1f);
+    SClusterMoment expectedProfit(profitability * (1.0f + trend * 0.3f), m_Profitability.m_Variance);
+
+    // Share of firms taking each branch of the individual decision tree
+    float saturation = macro.m_SectorSaturation[static_cast<int32_t>(m_Attributes.m_Sector)];
+    float shareExpanding = 0.0f;
+    if (saturation < 0.85f)
+    {
+        shareExpanding = ShareAbove(expectedProfit, 10.0f) * ShareAbove(m_Liquidity, 200.0f);
+    }
+    float shareStable = std::max(0.0f, ShareAbove(m_Profitability, 0.0f) - shareExpanding);
+    float shareDeclining = std::min(1.0f - shareExpanding - shareStable, ShareBelow(m_Profitability, -15.0f));
+    float shareCrisis = ShareBelow(m_Liquidity, 20.0f);
+
+    // Hiring and layoffs; the spread of firm sizes scales with the mean
+    float growthPotential = std::max(0.0f, 1.0f - (saturation * 1.5f));
+    float employmentFactor = 1.0f + 0.05f * growthPotential * shareExpanding
+                           - 0.05f * shareDeclining - 0.1f * shareCrisis;
+    float previousEmployees = m_Employees.m_Mean;
+    m_Employees.m_Mean = std::max(1.0f, previousEmployees * employmentFactor);
+    float employeeRatio = m_Employees.m_Mean / previousEmployees;
+    m_Employees.m_Variance *= employeeRatio * employeeRatio;
+
+    // Capacity and wages
+    m_CapacityUtilization += 0.05f * growthPotential * shareExpanding - 0.05f * shareDeclining;
+    m_CapacityUtilization = std::clamp(m_CapacityUtilization, 0.5f, 1.0f);
+
+    if (m_WageLevel < policy.m_MinimumWage * 3.0f)
+    {
+        m_WageLevel *= 1.0f + 0.005f * shareExpanding;
+    }
+    if (m_WageLevel > policy.m_MinimumWage)
+    {
+        m_WageLevel *= 1.0f - 0.02f * shareDeclining;
+    }
+    m_WageLevel = std::max(m_WageLevel, policy.m_MinimumWage);
+
+    // Firms in crisis borrow
+    m_Debt += 50.0f * shareCrisis;
+    m_Liquidity.m_Mean += 50.0f * shareCrisis;
+
+    // Informality as a pressure valve for small firms
+    if (policy.m_LaborRegulationBurden > 0.5f && m_Attributes.m_Size <= ECompanySize::Small)
+    {
+        m_Formality.m_Mean -= 0.1f * shareCrisis;
+    }
+    else if (policy.m_LaborRegulationBurden < 0.3f)
+    {
+        m_Formality.m_Mean += 0.05f * (1.0f - shareCrisis);
+    }
+    m_Formality.m_Mean = std::clamp(m_Formality.m_Mean, 0.0f, 1.0f);
+    m_Formality.m_Variance = std::min(m_Formality.m_Variance, m_Formality.m_Mean * (1.0f - m_Formality.m_Mean));
+
+    // Capital allocation of the mean firm
+    if (m_Liquidity.m_Mean > 100.0f && profitability > 0.0f)
+    {
+        float monthlyExpenses = m_Employees.m_Mean * m_WageLevel * 160.0f / 1000.0f;
+        float excessLiquidity = m_Liquidity.m_Mean - monthlyExpenses * 6.0f;
+        if (excessLiquidity > 0.0f)
+        {
+            float shareOther = std::max(0.0f, 1.0f - shareExpanding - shareStable - shareDeclining - shareCrisis);
+            float dividendRate = 0.4f * shareExpanding + 0.7f * shareStable + 0.2f * shareDeclining + 0.5f * shareOther;
+            m_Liquidity.m_Mean -= excessLiquidity * dividendRate;
+
+            // 30% of growing firms reinvest for a 3% productivity boost
+            float shareReinvesting = 0.3f * shareExpanding;
+            m_Attributes.m_BaseProductivity *= 1.0f + 0.03f * shareReinvesting;
+            m_Liquidity.m_Mean -= excessLiquidity * 0.3f * shareReinvesting;
+        }
+    }
+}
+
+void CCompanyCluster::UpdatePopulation(float entryRate, const SSimulationTick& tick)
+{
+    if (m_Population == 0)
+    {
+        m_LastEntries = 0;
+        m_LastExits = 0;
+        return;
+    }
+
+    float shareBankrupt = ShareBelow(m_Liquidity, CCompanyStore::BANKRUPTCY_LIQUIDITY);
+    float exitProbability = GetExitRate();
+    float entryProbability = std::clamp(entryRate, 0.0f, 1.0f);
+
+    CCounterRNG::Block draws = CCounterRNG::Generate(tick.m_WorldSeed, m_ID, tick.m_Tick, ERandomStream::ClusterDynamics);
+    int64_t exits = DrawBinomial(m_Population, exitProbability, draws[0], draws[1]);
+    int64_t entries = DrawBinomial(m_Population, entryProbability, draws[2], draws[3]);
+
+    // Bankrupt firms leave from the bottom of the liquidity distribution
+    if (exits > 0 && shareBankrupt > 0.0f && m_Liquidity.m_Variance > 0.0f)
+    {
+        double bankruptShare = std::min(1.0, (exits * (shareBankrupt / exitProbability)) / static_cast<double>(m_Population));
+        if (bankruptShare < 1.0)
+        {
+            double deviation = std::sqrt(static_cast<double>(m_Liquidity.m_Variance));
+            double alpha = (static_cast<double>(CCompanyStore::BANKRUPTCY_LIQUIDITY) - m_Liquidity.m_Mean) / deviation;
+            double tailDensity = std::exp(-0.5 * alpha * alpha) * 0.3989422804014327;
+            double tailMass = std::max(1.0e-12, static_cast<double>(ShareBelow(m_Liquidity, CCompanyStore::BANKRUPTCY_LIQUIDITY)));
+            double tailMean = m_Liquidity.m_Mean - deviation * tailDensity / tailMass;
+            m_Liquidity.m_Mean = static_cast<float>((m_Liquidity.m_Mean - bankruptShare * tailMean) / (1.0 - bankruptShare));
+        }
+    }
+
+    double survivors = static_cast<double>(m_Population - exits);
+    double newcomers = static_cast<double>(entries);
+
+    // Entrants start from the same state as a newly created company
+    float entrantEmployees = static_cast<float>(m_EntrantState.m_Employees);
+    m_Employees = Combine(m_Employees, survivors, SClusterMoment(entrantEmployees, 0.0f), newcomers);
+    m_Liquidity = Combine(m_Liquidity, survivors, SClusterMoment(m_EntrantState.m_Liquidity, 0.0f), newcomers);
+    m_Formality = Combine(m_Formality, survivors, SClusterMoment(m_EntrantState.m_FormalityLevel, 0.0f), newcomers);
+
+    double total = survivors + newcomers;
+    if (total > 0.0)
+    {
+        m_Debt = static_cast<float>((m_Debt * survivors + m_EntrantState.m_Debt * newcomers) / total);
+        m_WageLevel = static_cast<float>((m_WageLevel * survivors + m_EntrantState.m_WageLevel * newcomers) / total);
+        m_CapacityUtilization = static_cast<float>((m_CapacityUtilization * survivors +
+                                                    m_EntrantState.m_CapacityUtilization * newcomers) / total);
+    }
+
+    m_Population = m_Population - exits + entries;
+    m_LastEntries = entries;
+    m_LastExits = exits;
+}
+
+void CCompanyCluster::Accumulate(SCompanyAggregates& aggregates) const
+{
+    double population = static_cast<double>(m_Population);
+    int32_t sectorIndex = static_cast<int32_t>(m_Attributes.m_Sector);
+
+    aggregates.m_CompanyCount += population;
+    aggregates.m_TotalEmployees += m_Employees.m_Mean * population;
+    aggregates.m_TotalRevenue += m_Revenue * population;
+    aggregates.m_TotalProfit += m_Profitability.m_Mean * population;
+    aggregates.m_TotalWages += m_WageLevel * population;
+    aggregates.m_SectorCompanyCount[sectorIndex] += population;
+    aggregates.m_SectorRevenue[sectorIndex] += m_Revenue * population;
+}
+
+void CCompanyCluster::Absorb(const SCompanyState& state, double firms)
+{
+    int64_t absorbed = std::llround(firms);
+    if (absorbed <= 0)
+    {
+        return;
+    }
+
+    double incumbents = static_cast<double>(m_Population);
+    double newcomers = static_cast<double>(absorbed);
+    double total = incumbents + newcomers;
+
+    m_Employees = Combine(m_Employees, incumbents, SClusterMoment(static_cast<float>(state.m_Employees), 0.0f), newcomers);
+    m_Liquidity = Combine(m_Liquidity, incumbents, SClusterMoment(state.m_Liquidity, 0.0f), newcomers);
+    m_Profitability = Combine(m_Profitability, incumbents, SClusterMoment(state.m_Profitability, 0.0f), newcomers);
+    m_Formality = Combine(m_Formality, incumbents, SClusterMoment(state.m_FormalityLevel, 0.0f), newcomers);
+
+    m_Revenue = static_cast<float>((m_Revenue * incumbents + state.m_LastRevenue * newcomers) / total);
+    m_Debt = static_cast<float>((m_Debt * incumbents + state.m_Debt * newcomers) / total);
+    m_WageLevel = static_cast<float>((m_WageLevel * incumbents + state.m_WageLevel * newcomers) / total);
+    m_CapacityUtilization = static_cast<float>((m_CapacityUtilization * incumbents +
+                                                state.m_CapacityUtilization * newcomers) / total);
+
+    m_Population += absorbed;
+}
+
+void CCompanyCluster::Save(CSaveWriter& writer) const
+{
+    writer.Write(m_ID);
+    writer.Write(m_Region);
+    writer.Write(m_Attributes.m_Sector);
+    writer.Write(m_Attributes.m_Size);
+    writer.Write(m_Attributes.m_BaseProductivity);
+    writer.Write(m_Attributes.m_LaborIntensity);
+    writer.Write(m_Attributes.m_MarketCompetitiveness);
+    writer.Write(m_Attributes.m_DomesticOrientation);
+    writer.Write(m_Attributes.m_CapitalMobility);
+
+    writer.Write(m_EntrantState.m_Liquidity);
+    writer.Write(m_EntrantState.m_Profitability);
+    writer.Write(m_EntrantState.m_Debt);
+    writer.Write(m_EntrantState.m_LastRevenue);
+    writer.Write(m_EntrantState.m_Employees);
+    writer.Write(m_EntrantState.m_WageLevel);
+    writer.Write(m_EntrantState.m_CapacityUtilization);
+    writer.Write(m_EntrantState.m_ExpectedProfit);
+    writer.Write(m_EntrantState.m_PerceivedRisk);
+    writer.Write(m_EntrantState.m_State);
+    writer.Write(m_EntrantState.m_FormalityLevel);
+
+    writer.Write(m_Population);
+    writer.Write(m_LastEntries);
+    writer.Write(m_LastExits);
+    writer.Write(m_Employees);
+    writer.Write(m_Liquidity);
+    writer.Write(m_Profitability);
+    writer.Write(m_Formality);
+    writer.Write(m_Revenue);
+    writer.Write(m_Debt);
+    writer.Write(m_WageLevel);
+    writer.Write(m_CapacityUtilization);
+    writer.Write(m_AverageProfit);
+}
+
+bool CCompanyCluster::Load(CSaveReader& reader)
+{
+    reader.Read(m_ID);
+    reader.Read(m_Region);
+    reader.Read(m_Attributes.m_Sector);
+    reader.Read(m_Attributes.m_Size);
+    reader.Read(m_Attributes.m_BaseProductivity);
+    reader.Read(m_Attributes.m_LaborIntensity);
+    reader.Read(m_Attributes.m_MarketCompetitiveness);
+    reader.Read(m_Attributes.m_DomesticOrientation);
+    reader.Read(m_Attributes.m_CapitalMobility);
+
+    reader.Read(m_EntrantState.m_Liquidity);
+    reader.Read(m_EntrantState.m_Profitability);
+    reader.Read(m_EntrantState.m_Debt);
+    reader.Read(m_EntrantState.m_LastRevenue);
+    reader.Read(m_EntrantState.m_Employees);
+    reader.Read(m_EntrantState.m_WageLevel);
+    reader.Read(m_EntrantState.m_CapacityUtilization);
+    reader.Read(m_EntrantState.m_ExpectedProfit);
+    reader.Read(m_EntrantState.m_PerceivedRisk);
+    reader.Read(m_EntrantState.m_State);
+    reader.Read(m_EntrantState.m_FormalityLevel);
+
+    reader.Read(m_Population);
+    reader.Read(m_LastEntries);
+    reader.Read(m_LastExits);
+    reader.Read(m_Employees);
+    reader.Read(m_Liquidity);
+    reader.Read(m_Profitability);
+    reader.Read(m_Formality);
+    reader.Read(m_Revenue);
+    reader.Read(m_Debt);
+    reader.Read(m_WageLevel);
+    reader.Read(m_CapacityUtilization);
+    reader.Read(m_AverageProfit);
+
+    if (reader.IsGood() && (m_Attributes.m_Sector >= ESector::COUNT || m_Attributes.m_Size > ECompanySize::Large ||
+                            m_EntrantState.m_State > ECompanyState::Crisis || m_Population < 0))
+    {
+        reader.Fail("bad cluster");
+    }
+    return reader.IsGood();
+}
+
+void CCompanyCluster::HashState(CStateHash& hash) const
+{
+    hash.Add(m_ID);
+    hash.Add(m_Population);
+    hash.Add(m_LastEntries);
+    hash.Add(m_LastExits);
+    hash.Add(m_Employees);
+    hash.Add(m_Liquidity);
+    hash.Add(m_Profitability);
+    hash.Add(m_Formality);
+    hash.Add(m_Revenue);
+    hash.Add(m_Debt);
+    hash.Add(m_WageLevel);
+    hash.Add(m_CapacityUtilization);
+    hash.Add(m_AverageProfit);
+}
+
+} // namespace PoliticSim
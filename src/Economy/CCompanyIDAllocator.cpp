@@ -0,0 +1,145 @@
+#include "Economy/CCompanyIDAllocator.h"
+#include "Economy/CStateHash.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+
+namespace PoliticSim {
+
+CCompanyIDAllocator::CCompanyIDAllocator()
+    : m_Slots()
+    , m_FreeSlots()
+    , m_FreeHead(0)
+    , m_LiveCount(0)
+    , m_RetiredCount(0)
+{
+    Reset();
+}
+
+void CCompanyIDAllocator::Reset()
+{
+    // Slot 0 stays reserved for INVALID_ID
+    m_Slots.assign(1, 0);
+    m_FreeSlots.clear();
+    m_FreeHead = 0;
+    m_LiveCount = 0;
+    m_RetiredCount = 0;
+}
+
+uint32_t CCompanyIDAllocator::Allocate()
+{
+    uint32_t slot;
+    if (m_FreeHead < m_FreeSlots.size())
+    {
+        slot = m_FreeSlots[m_FreeHead++];
+
+        // Drop the consumed front once it is half the queue (amortized O(1))
+        if (m_FreeHead * 2 >= m_FreeSlots.size())
+        {
+            m_FreeSlots.erase(m_FreeSlots.begin(), m_FreeSlots.begin() + static_cast<std::ptrdiff_t>(m_FreeHead));
+            m_FreeHead = 0;
+        }
+    }
+    else if (m_Slots.size() <= SLOT_MASK)
+    {
+        slot = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.push_back(0);
+    }
+    else
+    {
+        return INVALID_ID;
+    }
+
+    m_Slots[slot] |= LIVE_BIT;
+    m_LiveCount++;
+    return static_cast<uint32_t>(m_Slots[slot] & GENERATION_MASK) << SLOT_BITS | slot;
+}
+
+void CCompanyIDAllocator::Release(uint32_t id)
+{
+    if (!IsAlive(id))
+    {
+        return;
+    }
+
+    // The next firm in this slot gets the next generation. After the last
+    // one the slot stays dead, so its IDs can never come back.
+    uint32_t slot = GetSlot(id);
+    uint32_t generation = GetGeneration(id) + 1;
+    m_LiveCount--;
+    if (generation >= RETIRED)
+    {
+        m_Slots[slot] = RETIRED;
+        m_RetiredCount++;
+        return;
+    }
+    m_Slots[slot] = static_cast<uint8_t>(generation);
+    m_FreeSlots.push_back(slot);
+}
+
+bool CCompanyIDAllocator::IsAlive(uint32_t id) const
+{
+    uint32_t slot = GetSlot(id);
+    return slot != 0 && slot < m_Slots.size() &&
+           m_Slots[slot] == (LIVE_BIT | static_cast<uint8_t>(GetGeneration(id)));
+}
+
+void CCompanyIDAllocator::Save(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("IDAL"));
+    writer.Write(static_cast<uint64_t>(m_Slots.size()));
+    writer.Write(static_cast<uint64_t>(GetFreeCount()));
+    writer.WriteArray(m_Slots.data(), m_Slots.size());
+    writer.WriteArray(m_FreeSlots.data() + m_FreeHead, GetFreeCount());
+    writer.EndChunk();
+}
+
+bool CCompanyIDAllocator::Load(CSaveReader& reader)
+{
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("IDAL")))
+    {
+        return false;
+    }
+    size_t slotCount = static_cast<size_t>(reader.Read<uint64_t>());
+    size_t freeCount = static_cast<size_t>(reader.Read<uint64_t>());
+    const uint8_t* slots = reader.ReadArray<uint8_t>(slotCount);
+    const uint32_t* freeSlots = reader.ReadArray<uint32_t>(freeCount);
+    reader.EndChunk();
+
+    if (!reader.IsGood() || slotCount == 0 || slotCount > static_cast<size_t>(SLOT_MASK) + 1)
+    {
+        reader.Fail("bad company ID pool");
+        return false;
+    }
+
+    m_Slots.assign(slots, slots + slotCount);
+    m_FreeSlots.assign(freeSlots, freeSlots + freeCount);
+    m_FreeHead = 0;
+
+    // Free slots must be real, released slots. Dead slots on their last
+    // generation are retired.
+    m_LiveCount = 0;
+    m_RetiredCount = 0;
+    for (size_t slot = 1; slot < slotCount; ++slot)
+    {
+        m_LiveCount += (m_Slots[slot] & LIVE_BIT) != 0 ? 1 : 0;
+        m_RetiredCount += m_Slots[slot] == RETIRED ? 1 : 0;
+    }
+    for (uint32_t slot : m_FreeSlots)
+    {
+        if (slot == 0 || slot >= slotCount || (m_Slots[slot] & LIVE_BIT) != 0 || m_Slots[slot] == RETIRED)
+        {
+            reader.Fail("bad company ID free list");
+            Reset();
+            return false;
+        }
+    }
+    return true;
+}
+
+void CCompanyIDAllocator::HashState(CStateHash& hash) const
+{
+    hash.AddBytes(m_Slots.data(), m_Slots.size());
+    hash.AddBytes(m_FreeSlots.data() + m_FreeHead, GetFreeCount() * sizeof(uint32_t));
+}
+
+} // namespace PoliticSim
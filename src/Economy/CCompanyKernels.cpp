@@ -0,0 +1,428 @@
+#include "Economy/CCompanyKernels.h"
+#include <algorithm>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POLITICSIM_KERNEL_SSE2 1
+#endif
+
+namespace PoliticSim {
+
+namespace {
+
+// Wage is in dollars/hour, costs are in thousands of dollars
+constexpr float MONTHLY_HOURS = 160.0f; // 40 hours/week × 4 weeks
+
+void ComputeFinancialsRange(const SFinancialBatch& batch, const SFinancialCoefficients& c, size_t begin)
+{
+    for (size_t i = begin; i < batch.m_Count; ++i)
+    {
+        int32_t sectorIndex = static_cast<int32_t>(batch.m_Sectors[i]);
+        int32_t sizeIndex = static_cast<int32_t>(batch.m_Sizes[i]);
+        float employees = static_cast<float>(batch.m_Employees[i]);
+
+        // Revenue = Employees × BaseProductivity × Demand × CapacityUtilization × Confidence
+        float revenue = employees * batch.m_BaseProductivity[i];
+        revenue = revenue * c.m_AggregateDemand * batch.m_CapacityUtilization[i] * c.m_ConfidenceFactor;
+
+        // Saturation reduces revenue potential (max 40% penalty, reduced by scale advantage)
+        float effectiveSaturation = std::max(0.0f, c.m_SectorSaturation[sectorIndex] - c.m_SizeScaleAdvantage[sizeIndex]);
+        revenue *= 1.0f - (effectiveSaturation * 0.4f);
+
+        // Import competition reduces revenue for domestic-focused companies
+        float domesticOrientation = batch.m_DomesticOrientation[i];
+        if (domesticOrientation > 0.5f)
+        {
+            float importPenalty = c.m_SectorImportCompetition[sectorIndex] * domesticOrientation * 0.25f;
+            revenue *= (1.0f - importPenalty);
+        }
+
+        batch.m_Revenue[i] = revenue;
+
+        // Labor costs (including labor tax)
+        float laborCost = employees * batch.m_WageLevel[i] * MONTHLY_HOURS / 1000.0f;
+        laborCost *= c.m_LaborTaxFactor;
+
+        // Regulatory burden (affects labor costs more for labor-intensive firms)
+        float regulationCost = laborCost * c.m_RegulationBurden * batch.m_LaborIntensity[i] * 1.5f;
+
+        // Environmental compliance (higher impact for strict policy)
+        float environmentalCost = laborCost * c.m_EnvironmentalCost * c.m_EnvironmentalMultiplier;
+
+        // Tariff impact (share of revenue exposed to trade depends on sector)
+        float tariffImpact = revenue * c.m_TariffRate * c.m_SectorTariffShare[sectorIndex];
+
+        // Financial costs (debt interest)
+        float financialCost = batch.m_Debt[i] * c.m_MonthlyInterestRate;
+
+        float totalCosts = laborCost + regulationCost + environmentalCost +
+                          financialCost + tariffImpact;
+
+        // Subsidies reduce costs, corporate tax applies to positive profit only
+        float subsidyAmount = totalCosts * c.m_SubsidyRate;
+        float preTaxProfit = revenue - totalCosts + subsidyAmount;
+        float taxAmount = 0.0f;
+        if (preTaxProfit > 0.0f)
+        {
+            taxAmount = preTaxProfit * c.m_CorporateTaxRate;
+        }
+
+        batch.m_Profitability[i] = preTaxProfit - taxAmount;
+    }
+}
+
+#if defined(__AVX512F__)
+template <bool BUCKET>
+size_t ComputeFinancialsAVX512(const SFinancialBatch& batch, const SFinancialCoefficients& c, size_t begin)
+{
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 saturationWeight = _mm512_set1_ps(0.4f);
+    const __m512 importWeight = _mm512_set1_ps(0.25f);
+    const __m512 regulationWeight = _mm512_set1_ps(1.5f);
+    const __m512 monthlyHours = _mm512_set1_ps(MONTHLY_HOURS);
+    const __m512 thousand = _mm512_set1_ps(1000.0f);
+
+    const __m512 demand = _mm512_set1_ps(c.m_AggregateDemand);
+    const __m512 confidence = _mm512_set1_ps(c.m_ConfidenceFactor);
+    const __m512 laborTax = _mm512_set1_ps(c.m_LaborTaxFactor);
+    const __m512 regulationBurden = _mm512_set1_ps(c.m_RegulationBurden);
+    const __m512 environmentalCost = _mm512_set1_ps(c.m_EnvironmentalCost);
+    const __m512 environmentalMultiplier = _mm512_set1_ps(c.m_EnvironmentalMultiplier);
+    const __m512 tariffRate = _mm512_set1_ps(c.m_TariffRate);
+    const __m512 monthlyInterest = _mm512_set1_ps(c.m_MonthlyInterestRate);
+    const __m512 subsidyRate = _mm512_set1_ps(c.m_SubsidyRate);
+    const __m512 corporateTax = _mm512_set1_ps(c.m_CorporateTaxRate);
+
+    // Only the low 8 lanes of each table are ever indexed
+    const __m512 saturationTable = _mm512_castps256_ps512(_mm256_loadu_ps(c.m_SectorSaturation));
+    const __m512 importTable = _mm512_castps256_ps512(_mm256_loadu_ps(c.m_SectorImportCompetition));
+    const __m512 tariffShareTable = _mm512_castps256_ps512(_mm256_loadu_ps(c.m_SectorTariffShare));
+    const __m512 scaleTable = _mm512_castps256_ps512(_mm256_loadu_ps(c.m_SizeScaleAdvantage));
+
+    // A bucket's lanes all look up the same entries, so look them up once
+    __m512i sector = _mm512_setzero_si512();
+    __m512i size = _mm512_setzero_si512();
+    if constexpr (BUCKET)
+    {
+        sector = _mm512_set1_epi32(static_cast<int32_t>(batch.m_Sectors[0]));
+        size = _mm512_set1_epi32(static_cast<int32_t>(batch.m_Sizes[0]));
+    }
+
+    size_t i = begin;
+    for (; i + 16 <= batch.m_Count; i += 16)
+    {
+        if constexpr (!BUCKET)
+        {
+            sector = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.m_Sectors + i)));
+            size = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.m_Sizes + i)));
+        }
+        __m512 employees = _mm512_cvtepi32_ps(_mm512_loadu_si512(batch.m_Employees + i));
+
+        __m512 revenue = _mm512_mul_ps(employees, _mm512_loadu_ps(batch.m_BaseProductivity + i));
+        revenue = _mm512_mul_ps(revenue, demand);
+        revenue = _mm512_mul_ps(revenue, _mm512_loadu_ps(batch.m_CapacityUtilization + i));
+        revenue = _mm512_mul_ps(revenue, confidence);
+
+        __m512 saturation = _mm512_permutexvar_ps(sector, saturationTable);
+        __m512 scaleAdvantage = _mm512_permutexvar_ps(size, scaleTable);
+        __m512 effectiveSaturation = _mm512_max_ps(_mm512_sub_ps(saturation, scaleAdvantage), zero);
+        revenue = _mm512_mul_ps(revenue, _mm512_sub_ps(one, _mm512_mul_ps(effectiveSaturation, saturationWeight)));
+
+        __m512 domestic = _mm512_loadu_ps(batch.m_DomesticOrientation + i);
+        __m512 importPenalty = _mm512_mul_ps(_mm512_mul_ps(_mm512_permutexvar_ps(sector, importTable), domestic), importWeight);
+        __mmask16 isDomestic = _mm512_cmp_ps_mask(domestic, half, _CMP_GT_OQ);
+        revenue = _mm512_mask_mul_ps(revenue, isDomestic, revenue, _mm512_sub_ps(one, importPenalty));
+        _mm512_storeu_ps(batch.m_Revenue + i, revenue);
+
+        __m512 laborCost = _mm512_mul_ps(_mm512_mul_ps(employees, _mm512_loadu_ps(batch.m_WageLevel + i)), monthlyHours);
+        laborCost = _mm512_mul_ps(_mm512_div_ps(laborCost, thousand), laborTax);
+        __m512 regulationCost = _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(laborCost, regulationBurden),
+                                                            _mm512_loadu_ps(batch.m_LaborIntensity + i)), regulationWeight);
+        __m512 environmental = _mm512_mul_ps(_mm512_mul_ps(laborCost, environmentalCost), environmentalMultiplier);
+        __m512 tariffImpact = _mm512_mul_ps(_mm512_mul_ps(revenue, tariffRate), _mm512_permutexvar_ps(sector, tariffShareTable));
+        __m512 financialCost = _mm512_mul_ps(_mm512_loadu_ps(batch.m_Debt + i), monthlyInterest);
+
+        __m512 totalCosts = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(_mm512_add_ps(laborCost, regulationCost),
+                                                                      environmental), financialCost), tariffImpact);
+        __m512 preTaxProfit = _mm512_add_ps(_mm512_sub_ps(revenue, totalCosts), _mm512_mul_ps(totalCosts, subsidyRate));
+        __mmask16 isProfitable = _mm512_cmp_ps_mask(preTaxProfit, zero, _CMP_GT_OQ);
+        __m512 taxAmount = _mm512_maskz_mul_ps(isProfitable, preTaxProfit, corporateTax);
+        _mm512_storeu_ps(batch.m_Profitability + i, _mm512_sub_ps(preTaxProfit, taxAmount));
+    }
+    return i;
+}
+#endif
+
+#if defined(__AVX2__)
+template <bool BUCKET>
+size_t ComputeFinancialsAVX2(const SFinancialBatch& batch, const SFinancialCoefficients& c, size_t begin)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 saturationWeight = _mm256_set1_ps(0.4f);
+    const __m256 importWeight = _mm256_set1_ps(0.25f);
+    const __m256 regulationWeight = _mm256_set1_ps(1.5f);
+    const __m256 monthlyHours = _mm256_set1_ps(MONTHLY_HOURS);
+    const __m256 thousand = _mm256_set1_ps(1000.0f);
+
+    const __m256 demand = _mm256_set1_ps(c.m_AggregateDemand);
+    const __m256 confidence = _mm256_set1_ps(c.m_ConfidenceFactor);
+    const __m256 laborTax = _mm256_set1_ps(c.m_LaborTaxFactor);
+    const __m256 regulationBurden = _mm256_set1_ps(c.m_RegulationBurden);
+    const __m256 environmentalCost = _mm256_set1_ps(c.m_EnvironmentalCost);
+    const __m256 environmentalMultiplier = _mm256_set1_ps(c.m_EnvironmentalMultiplier);
+    const __m256 tariffRate = _mm256_set1_ps(c.m_TariffRate);
+    const __m256 monthlyInterest = _mm256_set1_ps(c.m_MonthlyInterestRate);
+    const __m256 subsidyRate = _mm256_set1_ps(c.m_SubsidyRate);
+    const __m256 corporateTax = _mm256_set1_ps(c.m_CorporateTaxRate);
+
+    const __m256 saturationTable = _mm256_loadu_ps(c.m_SectorSaturation);
+    const __m256 importTable = _mm256_loadu_ps(c.m_SectorImportCompetition);
+    const __m256 tariffShareTable = _mm256_loadu_ps(c.m_SectorTariffShare);
+    const __m256 scaleTable = _mm256_loadu_ps(c.m_SizeScaleAdvantage);
+
+    // A bucket's lanes all look up the same entries, so look them up once
+    __m256i sector = _mm256_setzero_si256();
+    __m256i size = _mm256_setzero_si256();
+    if constexpr (BUCKET)
+    {
+        sector = _mm256_set1_epi32(static_cast<int32_t>(batch.m_Sectors[0]));
+        size = _mm256_set1_epi32(static_cast<int32_t>(batch.m_Sizes[0]));
+    }
+
+    size_t i = begin;
+    for (; i + 8 <= batch.m_Count; i += 8)
+    {
+        if constexpr (!BUCKET)
+        {
+            sector = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(batch.m_Sectors + i)));
+            size = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(batch.m_Sizes + i)));
+        }
+        __m256 employees = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.m_Employees + i)));
+
+        __m256 revenue = _mm256_mul_ps(employees, _mm256_loadu_ps(batch.m_BaseProductivity + i));
+        revenue = _mm256_mul_ps(revenue, demand);
+        revenue = _mm256_mul_ps(revenue, _mm256_loadu_ps(batch.m_CapacityUtilization + i));
+        revenue = _mm256_mul_ps(revenue, confidence);
+
+        __m256 saturation = _mm256_permutevar8x32_ps(saturationTable, sector);
+        __m256 scaleAdvantage = _mm256_permutevar8x32_ps(scaleTable, size);
+        __m256 effectiveSaturation = _mm256_max_ps(_mm256_sub_ps(saturation, scaleAdvantage), zero);
+        revenue = _mm256_mul_ps(revenue, _mm256_sub_ps(one, _mm256_mul_ps(effectiveSaturation, saturationWeight)));
+
+        __m256 domestic = _mm256_loadu_ps(batch.m_DomesticOrientation + i);
+        __m256 importPenalty = _mm256_mul_ps(_mm256_mul_ps(_mm256_permutevar8x32_ps(importTable, sector), domestic), importWeight);
+        __m256 isDomestic = _mm256_cmp_ps(domestic, half, _CMP_GT_OQ);
+        revenue = _mm256_blendv_ps(revenue, _mm256_mul_ps(revenue, _mm256_sub_ps(one, importPenalty)), isDomestic);
+        _mm256_storeu_ps(batch.m_Revenue + i, revenue);
+
+        __m256 laborCost = _mm256_mul_ps(_mm256_mul_ps(employees, _mm256_loadu_ps(batch.m_WageLevel + i)), monthlyHours);
+        laborCost = _mm256_mul_ps(_mm256_div_ps(laborCost, thousand), laborTax);
+        __m256 regulationCost = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(laborCost, regulationBurden),
+                                                            _mm256_loadu_ps(batch.m_LaborIntensity + i)), regulationWeight);
+        __m256 environmental = _mm256_mul_ps(_mm256_mul_ps(laborCost, environmentalCost), environmentalMultiplier);
+        __m256 tariffImpact = _mm256_mul_ps(_mm256_mul_ps(revenue, tariffRate), _mm256_permutevar8x32_ps(tariffShareTable, sector));
+        __m256 financialCost = _mm256_mul_ps(_mm256_loadu_ps(batch.m_Debt + i), monthlyInterest);
+
+        __m256 totalCosts = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(laborCost, regulationCost),
+                                                                      environmental), financialCost), tariffImpact);
+        __m256 preTaxProfit = _mm256_add_ps(_mm256_sub_ps(revenue, totalCosts), _mm256_mul_ps(totalCosts, subsidyRate));
+        __m256 isProfitable = _mm256_cmp_ps(preTaxProfit, zero, _CMP_GT_OQ);
+        __m256 taxAmount = _mm256_and_ps(_mm256_mul_ps(preTaxProfit, corporateTax), isProfitable);
+        _mm256_storeu_ps(batch.m_Profitability + i, _mm256_sub_ps(preTaxProfit, taxAmount));
+    }
+    return i;
+}
+#endif
+
+#if defined(POLITICSIM_KERNEL_SSE2)
+inline __m128 LookupSSE2(const float* table, const uint8_t* indices)
+{
+    return _mm_setr_ps(table[indices[0]], table[indices[1]], table[indices[2]], table[indices[3]]);
+}
+
+inline __m128 SelectSSE2(__m128 mask, __m128 ifTrue, __m128 ifFalse)
+{
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+template <bool BUCKET>
+size_t ComputeFinancialsSSE2(const SFinancialBatch& batch, const SFinancialCoefficients& c, size_t begin)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 saturationWeight = _mm_set1_ps(0.4f);
+    const __m128 importWeight = _mm_set1_ps(0.25f);
+    const __m128 regulationWeight = _mm_set1_ps(1.5f);
+    const __m128 monthlyHours = _mm_set1_ps(MONTHLY_HOURS);
+    const __m128 thousand = _mm_set1_ps(1000.0f);
+
+    const __m128 demand = _mm_set1_ps(c.m_AggregateDemand);
+    const __m128 confidence = _mm_set1_ps(c.m_ConfidenceFactor);
+    const __m128 laborTax = _mm_set1_ps(c.m_LaborTaxFactor);
+    const __m128 regulationBurden = _mm_set1_ps(c.m_RegulationBurden);
+    const __m128 environmentalCost = _mm_set1_ps(c.m_EnvironmentalCost);
+    const __m128 environmentalMultiplier = _mm_set1_ps(c.m_EnvironmentalMultiplier);
+    const __m128 tariffRate = _mm_set1_ps(c.m_TariffRate);
+    const __m128 monthlyInterest = _mm_set1_ps(c.m_MonthlyInterestRate);
+    const __m128 subsidyRate = _mm_set1_ps(c.m_SubsidyRate);
+    const __m128 corporateTax = _mm_set1_ps(c.m_CorporateTaxRate);
+
+    const uint8_t* sectors = reinterpret_cast<const uint8_t*>(batch.m_Sectors);
+    const uint8_t* sizes = reinterpret_cast<const uint8_t*>(batch.m_Sizes);
+
+    // A bucket's table entries are broadcast once instead of gathered
+    // lane by lane every iteration
+    __m128 saturation = _mm_setzero_ps();
+    __m128 scaleAdvantage = _mm_setzero_ps();
+    __m128 importCompetition = _mm_setzero_ps();
+    __m128 tariffShare = _mm_setzero_ps();
+    if constexpr (BUCKET)
+    {
+        saturation = _mm_set1_ps(c.m_SectorSaturation[sectors[0]]);
+        scaleAdvantage = _mm_set1_ps(c.m_SizeScaleAdvantage[sizes[0]]);
+        importCompetition = _mm_set1_ps(c.m_SectorImportCompetition[sectors[0]]);
+        tariffShare = _mm_set1_ps(c.m_SectorTariffShare[sectors[0]]);
+    }
+
+    size_t i = begin;
+    for (; i + 4 <= batch.m_Count; i += 4)
+    {
+        if constexpr (!BUCKET)
+        {
+            saturation = LookupSSE2(c.m_SectorSaturation, sectors + i);
+            scaleAdvantage = LookupSSE2(c.m_SizeScaleAdvantage, sizes + i);
+            importCompetition = LookupSSE2(c.m_SectorImportCompetition, sectors + i);
+            tariffShare = LookupSSE2(c.m_SectorTariffShare, sectors + i);
+        }
+
+        __m128 employees = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.m_Employees + i)));
+
+        __m128 revenue = _mm_mul_ps(employees, _mm_loadu_ps(batch.m_BaseProductivity + i));
+        revenue = _mm_mul_ps(revenue, demand);
+        revenue = _mm_mul_ps(revenue, _mm_loadu_ps(batch.m_CapacityUtilization + i));
+        revenue = _mm_mul_ps(revenue, confidence);
+
+        __m128 effectiveSaturation = _mm_max_ps(_mm_sub_ps(saturation, scaleAdvantage), zero);
+        revenue = _mm_mul_ps(revenue, _mm_sub_ps(one, _mm_mul_ps(effectiveSaturation, saturationWeight)));
+
+        __m128 domestic = _mm_loadu_ps(batch.m_DomesticOrientation + i);
+        __m128 importPenalty = _mm_mul_ps(_mm_mul_ps(importCompetition, domestic), importWeight);
+        __m128 isDomestic = _mm_cmpgt_ps(domestic, half);
+        revenue = SelectSSE2(isDomestic, _mm_mul_ps(revenue, _mm_sub_ps(one, importPenalty)), revenue);
+        _mm_storeu_ps(batch.m_Revenue + i, revenue);
+
+        __m128 laborCost = _mm_mul_ps(_mm_mul_ps(employees, _mm_loadu_ps(batch.m_WageLevel + i)), monthlyHours);
+        laborCost = _mm_mul_ps(_mm_div_ps(laborCost, thousand), laborTax);
+        __m128 regulationCost = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(laborCost, regulationBurden),
+                                                      _mm_loadu_ps(batch.m_LaborIntensity + i)), regulationWeight);
+        __m128 environmental = _mm_mul_ps(_mm_mul_ps(laborCost, environmentalCost), environmentalMultiplier);
+        __m128 tariffImpact = _mm_mul_ps(_mm_mul_ps(revenue, tariffRate), tariffShare);
+        __m128 financialCost = _mm_mul_ps(_mm_loadu_ps(batch.m_Debt + i), monthlyInterest);
+
+        __m128 totalCosts = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(laborCost, regulationCost),
+                                                             environmental), financialCost), tariffImpact);
+        __m128 preTaxProfit = _mm_add_ps(_mm_sub_ps(revenue, totalCosts), _mm_mul_ps(totalCosts, subsidyRate));
+        __m128 isProfitable = _mm_cmpgt_ps(preTaxProfit, zero);
+        __m128 taxAmount = _mm_and_ps(_mm_mul_ps(preTaxProfit, corporateTax), isProfitable);
+        _mm_storeu_ps(batch.m_Profitability + i, _mm_sub_ps(preTaxProfit, taxAmount));
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+SFinancialCoefficients CCompanyKernels::BuildCoefficients(const SPolicyParams& policy, const SMacroState& macro)
+{
+    SFinancialCoefficients c = {};
+
+    c.m_AggregateDemand = macro.m_AggregateDemand;
+    c.m_ConfidenceFactor = 0.8f + (macro.m_BusinessConfidence / 500.0f); // 0.8-1.0
+    c.m_LaborTaxFactor = 1.0f + policy.m_LaborTaxRate / 100.0f;
+    c.m_RegulationBurden = policy.m_LaborRegulationBurden;
+    c.m_EnvironmentalCost = policy.m_EnvironmentalComplianceCost;
+    c.m_EnvironmentalMultiplier = policy.m_StrictEnvironmentalPolicy ? 1.0f : 0.3f;
+    c.m_TariffRate = policy.m_TariffRate / 100.0f;
+    c.m_MonthlyInterestRate = macro.m_InterestRate / 100.0f / 12.0f;
+    c.m_SubsidyRate = policy.m_SubsidiesEnabled ? policy.m_SubsidyRate / 100.0f : 0.0f;
+    c.m_CorporateTaxRate = policy.m_CorporateTaxRate / 100.0f;
+
+    for (int32_t i = 0; i < static_cast<int32_t>(ESector::COUNT); ++i)
+    {
+        c.m_SectorSaturation[i] = macro.m_SectorSaturation[i];
+        c.m_SectorImportCompetition[i] = macro.m_ImportCompetition[i];
+    }
+
+    // Retail and tech are more affected by trade policy
+    c.m_SectorTariffShare[static_cast<int32_t>(ESector::Agriculture)] = 0.1f;
+    c.m_SectorTariffShare[static_cast<int32_t>(ESector::Industry)] = 0.3f;
+    c.m_SectorTariffShare[static_cast<int32_t>(ESector::Services)] = 0.1f;
+    c.m_SectorTariffShare[static_cast<int32_t>(ESector::Technology)] = 0.5f;
+    c.m_SectorTariffShare[static_cast<int32_t>(ESector::Retail)] = 0.5f;
+
+    // Scale advantage: Large companies handle saturation better (economies of scale)
+    c.m_SizeScaleAdvantage[static_cast<int32_t>(ECompanySize::Micro)] = 0.0f;
+    c.m_SizeScaleAdvantage[static_cast<int32_t>(ECompanySize::Small)] = 0.1f;
+    c.m_SizeScaleAdvantage[static_cast<int32_t>(ECompanySize::Medium)] = 0.2f;
+    c.m_SizeScaleAdvantage[static_cast<int32_t>(ECompanySize::Large)] = 0.35f;
+
+    return c;
+}
+
+template <bool BUCKET>
+void ComputeFinancialsWidest(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients)
+{
+    size_t i = 0;
+#if defined(__AVX512F__)
+    i = ComputeFinancialsAVX512<BUCKET>(batch, coefficients, i);
+#endif
+#if defined(__AVX2__)
+    i = ComputeFinancialsAVX2<BUCKET>(batch, coefficients, i);
+#endif
+#if defined(POLITICSIM_KERNEL_SSE2)
+    i = ComputeFinancialsSSE2<BUCKET>(batch, coefficients, i);
+#endif
+    ComputeFinancialsRange(batch, coefficients, i);
+}
+
+void CCompanyKernels::ComputeFinancials(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients)
+{
+    ComputeFinancialsWidest<false>(batch, coefficients);
+}
+
+void CCompanyKernels::ComputeFinancialsBucket(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients)
+{
+    if (batch.m_Count > 0)
+    {
+        ComputeFinancialsWidest<true>(batch, coefficients);
+    }
+}
+
+void CCompanyKernels::ComputeFinancialsScalar(const SFinancialBatch& batch, const SFinancialCoefficients& coefficients)
+{
+    ComputeFinancialsRange(batch, coefficients, 0);
+}
+
+const char* CCompanyKernels::GetInstructionSetName()
+{
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#elif defined(POLITICSIM_KERNEL_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+} // namespace PoliticSim
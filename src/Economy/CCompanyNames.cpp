@@ -0,0 +1,57 @@
+#include "Economy/CCompanyNames.h"
+#include "Random/CCounterRNG.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace PoliticSim {
+
+namespace {
+
+const char* const PREFIXES[] = {
+    "North", "South", "East", "West", "Silver", "Golden", "Iron", "Stone",
+    "Red", "Green", "Blue", "Oak", "Pine", "Lake", "River", "High",
+    "Bright", "Fair", "Clear", "Summit", "Harbor", "Maple", "Cedar", "Crown"
+};
+
+const char* const ROOTS[] = {
+    "field", "gate", "wood", "brook", "view", "ridge", "bridge", "land",
+    "stone", "haven", "crest", "ford", "vale", "point", "well", "way"
+};
+
+// Three endings per sector, in ESector order
+const char* const SECTOR_ENDINGS[][3] = {
+    { "Farms", "Growers", "Agro" },                 // Agriculture
+    { "Works", "Industries", "Manufacturing" },     // Industry
+    { "Services", "Partners", "Group" },            // Services
+    { "Systems", "Labs", "Digital" },               // Technology
+    { "Stores", "Market", "Trading" }               // Retail
+};
+
+template <typename T, size_t N>
+constexpr uint32_t CountOf(const T (&)[N])
+{
+    return static_cast<uint32_t>(N);
+}
+
+} // namespace
+
+size_t CCompanyNames::Format(uint32_t id, ESector sector, char* buffer, size_t size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    // One draw picks all three parts; names do not depend on the world seed
+    CCounterRNG::Block roll = CCounterRNG::Generate(CCounterRNG::DEFAULT_WORLD_SEED, id, 0,
+                                                    ERandomStream::CompanyName);
+    uint32_t sectorIndex = static_cast<uint32_t>(sector) % CountOf(SECTOR_ENDINGS);
+
+    int length = std::snprintf(buffer, size, "%s%s %s",
+                               PREFIXES[roll[0] % CountOf(PREFIXES)],
+                               ROOTS[roll[1] % CountOf(ROOTS)],
+                               SECTOR_ENDINGS[sectorIndex][roll[2] % 3]);
+    return length < 0 ? 0 : std::min(static_cast<size_t>(length), size - 1);
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,1098 @@
+#include "Economy/CCompanyStore.h"
+#include "Economy/CCompanyNames.h"
+#include "Economy/CCompanyIDAllocator.h"
+#include "Economy/CSamplingStrategy.h"
+#include "Economy/CStateHash.h"
+#include "Random/CCounterRNG.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <cmath>
+#include <algorithm>
+
+namespace PoliticSim {
+
+namespace {
+
+template <typename T>
+size_t ColumnBytes(const std::vector<T>& column)
+{
+    return column.capacity() * sizeof(T);
+}
+
+template <typename T>
+void AppendCopy(std::vector<T>& column, size_t index)
+{
+    T value = column[index];
+    column.push_back(value);
+}
+
+template <typename T>
+void SwapRemove(std::vector<T>& column, size_t index)
+{
+    column[index] = column.back();
+    column.pop_back();
+}
+
+template <typename T>
+void Gather(std::vector<T>& column, const std::vector<size_t>& order)
+{
+    std::vector<T> gathered;
+    gathered.reserve(column.capacity());
+    for (size_t index : order)
+    {
+        gathered.push_back(std::move(column[index]));
+    }
+    column.swap(gathered);
+}
+
+void BlendInto(std::vector<float>& column, size_t from, size_t into, double fromWeight, double intoWeight)
+{
+    column[into] = static_cast<float>((column[from] * fromWeight + column[into] * intoWeight) / (fromWeight + intoWeight));
+}
+
+} // namespace
+
+CCompanyStore::CCompanyStore()
+    : m_Shared(std::make_shared<SSharedColumns>())
+    , m_History()
+    , m_ExpectationMonths(0)
+    , m_ExpectationSmoothing(0.0f)
+{
+    SetExpectationWindow(DEFAULT_EXPECTATION_MONTHS);
+}
+
+void CCompanyStore::SetExpectationWindow(int32_t months)
+{
+    // Same center of mass as a simple moving average over the window
+    m_ExpectationMonths = std::max(months, 1);
+    m_ExpectationSmoothing = 2.0f / static_cast<float>(m_ExpectationMonths + 1);
+}
+
+void CCompanyStore::Reserve(size_t capacity)
+{
+    SSharedColumns& shared = Unshare();
+
+    shared.m_IDs.reserve(capacity);
+    m_Weights.reserve(capacity);
+    shared.m_Regions.reserve(capacity);
+
+    shared.m_Sectors.reserve(capacity);
+    shared.m_Sizes.reserve(capacity);
+    m_BaseProductivity.reserve(capacity);
+    shared.m_LaborIntensity.reserve(capacity);
+    shared.m_MarketCompetitiveness.reserve(capacity);
+    shared.m_DomesticOrientation.reserve(capacity);
+    shared.m_CapitalMobility.reserve(capacity);
+
+    m_Liquidity.reserve(capacity);
+    m_Profitability.reserve(capacity);
+    m_Debt.reserve(capacity);
+    m_LastRevenue.reserve(capacity);
+    m_Employees.reserve(capacity);
+    m_WageLevel.reserve(capacity);
+    m_CapacityUtilization.reserve(capacity);
+    m_ExpectedProfit.reserve(capacity);
+    m_AverageProfit.reserve(capacity);
+    m_PerceivedRisk.reserve(capacity);
+    m_States.reserve(capacity);
+    m_FormalityLevel.reserve(capacity);
+
+    m_History.Reserve(capacity);
+}
+
+void CCompanyStore::Clear()
+{
+    // A fork may still read the old shared columns, so start new ones
+    m_Shared = std::make_shared<SSharedColumns>();
+    m_Weights.clear();
+    m_BaseProductivity.clear();
+
+    m_Liquidity.clear();
+    m_Profitability.clear();
+    m_Debt.clear();
+    m_LastRevenue.clear();
+    m_Employees.clear();
+    m_WageLevel.clear();
+    m_CapacityUtilization.clear();
+    m_ExpectedProfit.clear();
+    m_AverageProfit.clear();
+    m_PerceivedRisk.clear();
+    m_States.clear();
+    m_FormalityLevel.clear();
+
+    m_History.Clear();
+}
+
+SCompanyState CCompanyStore::MakeInitialState(const SCompanyAttributes& attributes)
+{
+    SCompanyState state;
+
+    // Set initial state based on size
+    switch (attributes.m_Size)
+    {
+        case ECompanySize::Micro:
+            state.m_Employees = 5;
+            state.m_Liquidity = 20.0f;
+            state.m_WageLevel = 18.0f;  // Increased from $12
+            break;
+        case ECompanySize::Small:
+            state.m_Employees = 25;
+            state.m_Liquidity = 100.0f;
+            state.m_WageLevel = 22.0f;  // Increased from $15
+            break;
+        case ECompanySize::Medium:
+            state.m_Employees = 150;
+            state.m_Liquidity = 500.0f;
+            state.m_WageLevel = 27.0f;  // Increased from $18
+            break;
+        case ECompanySize::Large:
+            state.m_Employees = 1000;
+            state.m_Liquidity = 5000.0f;
+            state.m_WageLevel = 33.0f;  // Increased from $22
+            break;
+    }
+
+    // Adjust wage by sector
+    switch (attributes.m_Sector)
+    {
+        case ESector::Agriculture:
+            state.m_WageLevel *= 0.8f;
+            break;
+        case ESector::Industry:
+            state.m_WageLevel *= 1.0f;
+            break;
+        case ESector::Services:
+            state.m_WageLevel *= 0.9f;
+            break;
+        case ESector::Technology:
+            state.m_WageLevel *= 1.5f;
+            break;
+        case ESector::Retail:
+            state.m_WageLevel *= 0.85f;
+            break;
+        case ESector::COUNT:
+            break;
+    }
+
+    // Set initial capacity utilization based on size
+    switch (attributes.m_Size)
+    {
+        case ECompanySize::Micro:
+            state.m_CapacityUtilization = 0.7f;
+            break;
+        case ECompanySize::Small:
+            state.m_CapacityUtilization = 0.75f;
+            break;
+        case ECompanySize::Medium:
+            state.m_CapacityUtilization = 0.8f;
+            break;
+        case ECompanySize::Large:
+            state.m_CapacityUtilization = 0.85f;
+            break;
+    }
+
+    return state;
+}
+
+size_t CCompanyStore::AddCompany(uint32_t id, const SCompanyAttributes& attributes, float weight, uint16_t region)
+{
+    SSharedColumns& shared = Unshare();
+
+    size_t index = shared.m_IDs.size();
+
+    shared.m_IDs.push_back(id);
+    m_Weights.push_back(weight);
+    shared.m_Regions.push_back(region);
+
+    shared.m_Sectors.push_back(attributes.m_Sector);
+    shared.m_Sizes.push_back(attributes.m_Size);
+    m_BaseProductivity.push_back(attributes.m_BaseProductivity);
+    shared.m_LaborIntensity.push_back(attributes.m_LaborIntensity);
+    shared.m_MarketCompetitiveness.push_back(attributes.m_MarketCompetitiveness);
+    shared.m_DomesticOrientation.push_back(attributes.m_DomesticOrientation);
+    shared.m_CapitalMobility.push_back(attributes.m_CapitalMobility);
+
+    SCompanyState state = MakeInitialState(attributes);
+
+    m_Liquidity.push_back(state.m_Liquidity);
+    m_Profitability.push_back(state.m_Profitability);
+    m_Debt.push_back(state.m_Debt);
+    m_LastRevenue.push_back(state.m_LastRevenue);
+    m_Employees.push_back(state.m_Employees);
+    m_WageLevel.push_back(state.m_WageLevel);
+    m_CapacityUtilization.push_back(state.m_CapacityUtilization);
+    m_ExpectedProfit.push_back(state.m_ExpectedProfit);
+    m_AverageProfit.push_back(0.0f);
+    m_PerceivedRisk.push_back(state.m_PerceivedRisk);
+    m_States.push_back(state.m_State);
+    m_FormalityLevel.push_back(state.m_FormalityLevel);
+
+    IndexRow(shared, index);
+
+    // Initialize history to zero
+    m_History.Resize(shared.m_IDs.size());
+
+    return index;
+}
+
+size_t CCompanyStore::SplitCompany(size_t index, uint32_t id)
+{
+    SSharedColumns& shared = Unshare();
+
+    size_t split = shared.m_IDs.size();
+
+    shared.m_IDs.push_back(id);
+    m_Weights.push_back(1.0f);
+    m_Weights[index] -= 1.0f;
+    AppendCopy(shared.m_Regions, index);
+
+    AppendCopy(shared.m_Sectors, index);
+    AppendCopy(shared.m_Sizes, index);
+    AppendCopy(m_BaseProductivity, index);
+    AppendCopy(shared.m_LaborIntensity, index);
+    AppendCopy(shared.m_MarketCompetitiveness, index);
+    AppendCopy(shared.m_DomesticOrientation, index);
+    AppendCopy(shared.m_CapitalMobility, index);
+
+    AppendCopy(m_Liquidity, index);
+    AppendCopy(m_Profitability, index);
+    AppendCopy(m_Debt, index);
+    AppendCopy(m_LastRevenue, index);
+    AppendCopy(m_Employees, index);
+    AppendCopy(m_WageLevel, index);
+    AppendCopy(m_CapacityUtilization, index);
+    AppendCopy(m_ExpectedProfit, index);
+    AppendCopy(m_AverageProfit, index);
+    AppendCopy(m_PerceivedRisk, index);
+    AppendCopy(m_States, index);
+    AppendCopy(m_FormalityLevel, index);
+
+    // The split firm inherits the history of the row it came from
+    IndexRow(shared, split);
+
+    m_History.Resize(shared.m_IDs.size());
+    m_History.CopyCompany(index, split);
+
+    return split;
+}
+
+void CCompanyStore::MergeCompany(size_t from, size_t into)
+{
+    double fromWeight = m_Weights[from];
+    double intoWeight = m_Weights[into];
+    if (fromWeight + intoWeight <= 0.0)
+    {
+        return;
+    }
+
+    // 'into' keeps its identity, discrete state and history
+    SSharedColumns& shared = Unshare();
+    BlendInto(m_BaseProductivity, from, into, fromWeight, intoWeight);
+    BlendInto(shared.m_LaborIntensity, from, into, fromWeight, intoWeight);
+    BlendInto(shared.m_MarketCompetitiveness, from, into, fromWeight, intoWeight);
+    BlendInto(shared.m_DomesticOrientation, from, into, fromWeight, intoWeight);
+    BlendInto(shared.m_CapitalMobility, from, into, fromWeight, intoWeight);
+
+    BlendInto(m_Liquidity, from, into, fromWeight, intoWeight);
+    BlendInto(m_Profitability, from, into, fromWeight, intoWeight);
+    BlendInto(m_Debt, from, into, fromWeight, intoWeight);
+    BlendInto(m_LastRevenue, from, into, fromWeight, intoWeight);
+    BlendInto(m_WageLevel, from, into, fromWeight, intoWeight);
+    BlendInto(m_CapacityUtilization, from, into, fromWeight, intoWeight);
+    BlendInto(m_ExpectedProfit, from, into, fromWeight, intoWeight);
+    BlendInto(m_AverageProfit, from, into, fromWeight, intoWeight);
+    BlendInto(m_PerceivedRisk, from, into, fromWeight, intoWeight);
+    BlendInto(m_FormalityLevel, from, into, fromWeight, intoWeight);
+
+    double employees = (m_Employees[from] * fromWeight + m_Employees[into] * intoWeight) / (fromWeight + intoWeight);
+    m_Employees[into] = static_cast<int32_t>(std::lround(employees));
+
+    m_Weights[into] = static_cast<float>(fromWeight + intoWeight);
+    m_Weights[from] = 0.0f;
+}
+
+void CCompanyStore::RemoveCompany(size_t index)
+{
+    SSharedColumns& shared = Unshare();
+
+    size_t last = shared.m_IDs.size() - 1;
+    if (index != last)
+    {
+        m_History.CopyCompany(last, index);
+    }
+
+    SwapRemove(shared.m_IDs, index);
+    SwapRemove(m_Weights, index);
+    SwapRemove(shared.m_Regions, index);
+
+    SwapRemove(shared.m_Sectors, index);
+    SwapRemove(shared.m_Sizes, index);
+    SwapRemove(m_BaseProductivity, index);
+    SwapRemove(shared.m_LaborIntensity, index);
+    SwapRemove(shared.m_MarketCompetitiveness, index);
+    SwapRemove(shared.m_DomesticOrientation, index);
+    SwapRemove(shared.m_CapitalMobility, index);
+
+    SwapRemove(m_Liquidity, index);
+    SwapRemove(m_Profitability, index);
+    SwapRemove(m_Debt, index);
+    SwapRemove(m_LastRevenue, index);
+    SwapRemove(m_Employees, index);
+    SwapRemove(m_WageLevel, index);
+    SwapRemove(m_CapacityUtilization, index);
+    SwapRemove(m_ExpectedProfit, index);
+    SwapRemove(m_AverageProfit, index);
+    SwapRemove(m_PerceivedRisk, index);
+    SwapRemove(m_States, index);
+    SwapRemove(m_FormalityLevel, index);
+
+    // The last row moved into 'index'
+    if (index < shared.m_IDs.size())
+    {
+        IndexRow(shared, index);
+    }
+
+    m_History.Resize(shared.m_IDs.size());
+}
+
+void CCompanyStore::SortByRegion()
+{
+    GroupRows(false, false);
+}
+
+void CCompanyStore::SortByBucket()
+{
+    GroupRows(true, false);
+}
+
+void CCompanyStore::Compact()
+{
+    GroupRows(true, true);
+}
+
+size_t CCompanyStore::GetBucket(size_t index) const
+{
+    const SSharedColumns& shared = *m_Shared;
+    return static_cast<size_t>(shared.m_Regions[index]) * CSamplingStrategy::STRATUM_COUNT +
+           static_cast<size_t>(CSamplingStrategy::GetStratumIndex(shared.m_Sectors[index], shared.m_Sizes[index]));
+}
+
+void CCompanyStore::GroupRows(bool byStratum, bool dropClosed)
+{
+    const SSharedColumns& shared = *m_Shared;
+    auto keyOf = [&](size_t index)
+    {
+        return byStratum ? GetBucket(index) : static_cast<size_t>(shared.m_Regions[index]);
+    };
+
+    // Counting sort keeps the order of rows within a bucket
+    size_t count = GetCount();
+    bool sorted = true;
+    size_t kept = 0;
+    size_t lastBucket = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t bucket = keyOf(i);
+        sorted = sorted && (i == 0 || keyOf(i - 1) <= bucket);
+        kept += dropClosed && IsClosed(i) ? 0 : 1;
+        lastBucket = std::max(lastBucket, bucket);
+    }
+    if (sorted && kept == count)
+    {
+        return;
+    }
+
+    std::vector<size_t> offsets(lastBucket + 2, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!dropClosed || !IsClosed(i))
+        {
+            offsets[keyOf(i) + 1]++;
+        }
+    }
+
+    for (size_t bucket = 1; bucket < offsets.size(); ++bucket)
+    {
+        offsets[bucket] += offsets[bucket - 1];
+    }
+
+    std::vector<size_t> order(kept);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!dropClosed || !IsClosed(i))
+        {
+            order[offsets[keyOf(i)]++] = i;
+        }
+    }
+    Reorder(order);
+}
+
+void CCompanyStore::CloseCompany(size_t index)
+{
+    m_Weights[index] = 0.0f;
+    m_Employees[index] = 0;
+    m_CapacityUtilization[index] = 0.0f;
+}
+
+void CCompanyStore::ReplaceCompany(size_t index, uint32_t id, const SCompanyAttributes& attributes,
+                                   float weight, uint16_t region)
+{
+    SSharedColumns& shared = Unshare();
+
+    shared.m_IDs[index] = id;
+    m_Weights[index] = weight;
+    shared.m_Regions[index] = region;
+
+    shared.m_Sectors[index] = attributes.m_Sector;
+    shared.m_Sizes[index] = attributes.m_Size;
+    m_BaseProductivity[index] = attributes.m_BaseProductivity;
+    shared.m_LaborIntensity[index] = attributes.m_LaborIntensity;
+    shared.m_MarketCompetitiveness[index] = attributes.m_MarketCompetitiveness;
+    shared.m_DomesticOrientation[index] = attributes.m_DomesticOrientation;
+    shared.m_CapitalMobility[index] = attributes.m_CapitalMobility;
+
+    SCompanyState state = MakeInitialState(attributes);
+
+    m_Liquidity[index] = state.m_Liquidity;
+    m_Profitability[index] = state.m_Profitability;
+    m_Debt[index] = state.m_Debt;
+    m_LastRevenue[index] = state.m_LastRevenue;
+    m_Employees[index] = state.m_Employees;
+    m_WageLevel[index] = state.m_WageLevel;
+    m_CapacityUtilization[index] = state.m_CapacityUtilization;
+    m_ExpectedProfit[index] = state.m_ExpectedProfit;
+    m_AverageProfit[index] = 0.0f;
+    m_PerceivedRisk[index] = state.m_PerceivedRisk;
+    m_States[index] = state.m_State;
+    m_FormalityLevel[index] = state.m_FormalityLevel;
+
+    IndexRow(shared, index);
+
+    // The new firm starts without the closed one's history
+    m_History.ClearCompany(index);
+}
+
+void CCompanyStore::Reorder(const std::vector<size_t>& order)
+{
+    SSharedColumns& shared = Unshare();
+
+    Gather(shared.m_IDs, order);
+    Gather(m_Weights, order);
+    Gather(shared.m_Regions, order);
+
+    Gather(shared.m_Sectors, order);
+    Gather(shared.m_Sizes, order);
+    Gather(m_BaseProductivity, order);
+    Gather(shared.m_LaborIntensity, order);
+    Gather(shared.m_MarketCompetitiveness, order);
+    Gather(shared.m_DomesticOrientation, order);
+    Gather(shared.m_CapitalMobility, order);
+
+    Gather(m_Liquidity, order);
+    Gather(m_Profitability, order);
+    Gather(m_Debt, order);
+    Gather(m_LastRevenue, order);
+    Gather(m_Employees, order);
+    Gather(m_WageLevel, order);
+    Gather(m_CapacityUtilization, order);
+    Gather(m_ExpectedProfit, order);
+    Gather(m_AverageProfit, order);
+    Gather(m_PerceivedRisk, order);
+    Gather(m_States, order);
+    Gather(m_FormalityLevel, order);
+
+    RebuildRowIndex(shared);
+    m_History.Reorder(order);
+}
+
+void CCompanyStore::IndexRow(SSharedColumns& shared, size_t index)
+{
+    if (IsClosed(index))
+    {
+        return;
+    }
+
+    uint32_t slot = CCompanyIDAllocator::GetSlot(shared.m_IDs[index]);
+    if (slot >= shared.m_RowOfSlot.size())
+    {
+        shared.m_RowOfSlot.resize(static_cast<size_t>(slot) + 1, static_cast<uint32_t>(INVALID_ROW));
+    }
+    shared.m_RowOfSlot[slot] = static_cast<uint32_t>(index);
+}
+
+void CCompanyStore::RebuildRowIndex(SSharedColumns& shared)
+{
+    std::fill(shared.m_RowOfSlot.begin(), shared.m_RowOfSlot.end(), static_cast<uint32_t>(INVALID_ROW));
+    for (size_t i = 0; i < shared.m_IDs.size(); ++i)
+    {
+        IndexRow(shared, i);
+    }
+}
+
+size_t CCompanyStore::FindRow(uint32_t id) const
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    uint32_t slot = CCompanyIDAllocator::GetSlot(id);
+    if (slot >= shared.m_RowOfSlot.size())
+    {
+        return INVALID_ROW;
+    }
+
+    // Stale entries point at a row holding another ID, or a closed one
+    size_t row = shared.m_RowOfSlot[slot];
+    if (row >= shared.m_IDs.size() || shared.m_IDs[row] != id || IsClosed(row))
+    {
+        return INVALID_ROW;
+    }
+    return row;
+}
+
+CCompanyStore::SSharedColumns& CCompanyStore::Unshare()
+{
+    // Forks are made and destroyed on the thread that owns this store
+    // (CEconomyProjection joins before it drops one), so use_count is exact
+    if (m_Shared.use_count() > 1)
+    {
+        m_Shared = std::make_shared<SSharedColumns>(*m_Shared);
+    }
+    return *m_Shared;
+}
+
+CCompanyStore CCompanyStore::Fork() const
+{
+    CCompanyStore fork;
+    fork.m_Shared = m_Shared;
+    fork.m_Weights = m_Weights;
+    fork.m_BaseProductivity = m_BaseProductivity;
+
+    fork.m_Liquidity = m_Liquidity;
+    fork.m_Profitability = m_Profitability;
+    fork.m_Debt = m_Debt;
+    fork.m_LastRevenue = m_LastRevenue;
+    fork.m_Employees = m_Employees;
+    fork.m_WageLevel = m_WageLevel;
+    fork.m_CapacityUtilization = m_CapacityUtilization;
+    fork.m_ExpectedProfit = m_ExpectedProfit;
+    fork.m_AverageProfit = m_AverageProfit;
+    fork.m_PerceivedRisk = m_PerceivedRisk;
+    fork.m_States = m_States;
+    fork.m_FormalityLevel = m_FormalityLevel;
+
+    // History is never read by the tick, so the fork records nothing
+    SHistoryConfig history = m_History.GetConfig();
+    history.m_MetricMask = 0;
+    fork.m_History.Configure(history);
+    fork.m_History.Resize(GetCount());
+
+    fork.m_ExpectationMonths = m_ExpectationMonths;
+    fork.m_ExpectationSmoothing = m_ExpectationSmoothing;
+    return fork;
+}
+
+size_t CCompanyStore::GetMemoryBytes() const
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    size_t bytes = ColumnBytes(shared.m_IDs) + ColumnBytes(shared.m_RowOfSlot) + ColumnBytes(m_Weights) +
+                   ColumnBytes(shared.m_Regions);
+
+    bytes += ColumnBytes(shared.m_Sectors) + ColumnBytes(shared.m_Sizes) + ColumnBytes(m_BaseProductivity) +
+             ColumnBytes(shared.m_LaborIntensity) + ColumnBytes(shared.m_MarketCompetitiveness) +
+             ColumnBytes(shared.m_DomesticOrientation) + ColumnBytes(shared.m_CapitalMobility);
+
+    bytes += ColumnBytes(m_Liquidity) + ColumnBytes(m_Profitability) + ColumnBytes(m_Debt) +
+             ColumnBytes(m_LastRevenue) + ColumnBytes(m_Employees) + ColumnBytes(m_WageLevel) +
+             ColumnBytes(m_CapacityUtilization) + ColumnBytes(m_ExpectedProfit) + ColumnBytes(m_AverageProfit) +
+             ColumnBytes(m_PerceivedRisk) + ColumnBytes(m_States) + ColumnBytes(m_FormalityLevel);
+
+    return bytes + m_History.GetMemoryBytes();
+}
+
+void CCompanyStore::Save(CSaveWriter& writer) const
+{
+    size_t count = GetCount();
+    writer.BeginChunk(SSaveFormat::MakeTag("COMP"));
+    writer.Write(static_cast<uint64_t>(count));
+    writer.Write(m_ExpectationMonths);
+    writer.EndChunk();
+
+    ForEachColumn(*this,
+        [&writer](const auto& tag, const auto& column)
+        {
+            writer.WriteColumn(SSaveFormat::MakeTag(tag), column.data(), column.size());
+        });
+
+    m_History.Save(writer);
+}
+
+void CCompanyStore::HashState(CStateHash& hash) const
+{
+    ForEachColumn(*this,
+        [&hash](const auto&, const auto& column)
+        {
+            hash.AddBytes(column.data(), column.size() * sizeof(column[0]));
+        });
+}
+
+bool CCompanyStore::Load(CSaveReader& reader)
+{
+    Clear();
+
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("COMP")))
+    {
+        return false;
+    }
+    size_t count = static_cast<size_t>(reader.Read<uint64_t>());
+    int32_t expectationMonths = reader.Read<int32_t>();
+    reader.EndChunk();
+
+    // Each column is one bulk copy out of the mapped file (Clear left the
+    // shared columns unshared)
+    SSharedColumns& shared = *m_Shared;
+    ForEachColumn(*this,
+        [&reader, count](const auto& tag, auto& column)
+        {
+            reader.ReadColumn(SSaveFormat::MakeTag(tag), count, column);
+        });
+
+    // Enums index coefficient tables, so out-of-range values are rejected here
+    for (size_t i = 0; i < shared.m_Sectors.size() && reader.IsGood(); ++i)
+    {
+        if (shared.m_Sectors[i] >= ESector::COUNT || shared.m_Sizes[i] > ECompanySize::Large || m_States[i] > ECompanyState::Crisis)
+        {
+            reader.Fail("bad company type");
+        }
+    }
+
+    if (reader.IsGood() && m_History.Load(reader) && m_History.GetCount() != count)
+    {
+        reader.Fail("history does not match the companies");
+    }
+    if (!reader.IsGood())
+    {
+        Clear();
+        return false;
+    }
+
+    RebuildRowIndex(shared);
+
+    SetExpectationWindow(expectationMonths);
+    return true;
+}
+
+size_t CCompanyStore::FormatName(size_t index, char* buffer, size_t size) const
+{
+    return CCompanyNames::Format(m_Shared->m_IDs[index], m_Shared->m_Sectors[index], buffer, size);
+}
+
+SCompanyAttributes CCompanyStore::GetAttributes(size_t index) const
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    SCompanyAttributes attributes;
+    attributes.m_Sector = shared.m_Sectors[index];
+    attributes.m_Size = shared.m_Sizes[index];
+    attributes.m_BaseProductivity = m_BaseProductivity[index];
+    attributes.m_LaborIntensity = shared.m_LaborIntensity[index];
+    attributes.m_MarketCompetitiveness = shared.m_MarketCompetitiveness[index];
+    attributes.m_DomesticOrientation = shared.m_DomesticOrientation[index];
+    attributes.m_CapitalMobility = shared.m_CapitalMobility[index];
+    return attributes;
+}
+
+SCompanyState CCompanyStore::GetState(size_t index) const
+{
+    SCompanyState state;
+    state.m_Liquidity = m_Liquidity[index];
+    state.m_Profitability = m_Profitability[index];
+    state.m_Debt = m_Debt[index];
+    state.m_LastRevenue = m_LastRevenue[index];
+    state.m_Employees = m_Employees[index];
+    state.m_WageLevel = m_WageLevel[index];
+    state.m_CapacityUtilization = m_CapacityUtilization[index];
+    state.m_ExpectedProfit = m_ExpectedProfit[index];
+    state.m_PerceivedRisk = m_PerceivedRisk[index];
+    state.m_State = m_States[index];
+    state.m_FormalityLevel = m_FormalityLevel[index];
+    return state;
+}
+
+void CCompanyStore::SimulateRange(size_t begin, size_t end, const SPolicyParams& policy, const SMacroState& macro,
+                                  const SSimulationTick& tick)
+{
+    // Policy and macro inputs are constant for the whole month
+    SFinancialCoefficients coefficients = CCompanyKernels::BuildCoefficients(policy, macro);
+
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SIMULATION_BLOCK_SIZE)
+    {
+        size_t blockEnd = std::min(end, blockBegin + SIMULATION_BLOCK_SIZE);
+
+        // Closed rows awaiting reuse or compaction are skipped, so they cost
+        // nothing and keep the state they closed with
+        size_t runBegin = blockBegin;
+        while (runBegin < blockEnd)
+        {
+            while (runBegin < blockEnd && IsClosed(runBegin))
+            {
+                ++runBegin;
+            }
+            size_t runEnd = runBegin;
+            while (runEnd < blockEnd && !IsClosed(runEnd))
+            {
+                ++runEnd;
+            }
+            if (runBegin < runEnd)
+            {
+                SimulateBlock(runBegin, runEnd, coefficients, policy, macro, tick);
+            }
+            runBegin = runEnd;
+        }
+    }
+}
+
+void CCompanyStore::SimulateBlock(size_t begin, size_t end, const SFinancialCoefficients& coefficients,
+                                  const SPolicyParams& policy, const SMacroState& macro, const SSimulationTick& tick)
+{
+    // 1-2. Calculate revenue and costs (batched kernel)
+    CalculateFinancials(begin, end, coefficients);
+
+    // 3. Update liquidity
+    UpdateLiquidity(begin, end);
+
+    // 4. Update history and expectations
+    UpdateHistory(begin, end);
+    UpdateExpectations(begin, end);
+
+    // 5. Make decisions (hire/fire, invest, etc.)
+    MakeDecisions(begin, end, policy, macro, tick);
+
+    // 6. Check for bankruptcy
+    CheckBankruptcy(begin, end);
+}
+
+void CCompanyStore::SimulateCompany(size_t index, const SPolicyParams& policy, const SMacroState& macro,
+                                    const SSimulationTick& tick)
+{
+    SimulateRange(index, index + 1, policy, macro, tick);
+}
+
+void CCompanyStore::AdvanceHistory()
+{
+    m_History.Advance();
+}
+
+void CCompanyStore::ConfigureHistory(const SHistoryConfig& config)
+{
+    m_History.Configure(config);
+}
+
+SCompanyAggregates CCompanyStore::Aggregate(size_t begin, size_t end) const
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    SCompanyAggregates aggregates;
+
+    // Weight 1 products are exact, so unsampled worlds sum exactly as before
+    for (size_t i = begin; i < end; ++i)
+    {
+        double weight = m_Weights[i];
+        double revenue = weight * m_LastRevenue[i];
+        aggregates.m_CompanyCount += weight;
+        aggregates.m_TotalEmployees += weight * m_Employees[i];
+        aggregates.m_TotalRevenue += revenue;
+        aggregates.m_TotalProfit += weight * m_Profitability[i];
+        aggregates.m_TotalWages += weight * m_WageLevel[i];
+
+        int32_t sectorIndex = static_cast<int32_t>(shared.m_Sectors[i]);
+        aggregates.m_SectorCompanyCount[sectorIndex] += weight;
+        aggregates.m_SectorRevenue[sectorIndex] += revenue;
+    }
+
+    return aggregates;
+}
+
+void CCompanyStore::CalculateFinancials(size_t begin, size_t end, const SFinancialCoefficients& coefficients)
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    auto makeBatch = [&](size_t first, size_t last)
+    {
+        SFinancialBatch batch;
+        batch.m_Count = last - first;
+        batch.m_Employees = &m_Employees[first];
+        batch.m_BaseProductivity = &m_BaseProductivity[first];
+        batch.m_CapacityUtilization = &m_CapacityUtilization[first];
+        batch.m_DomesticOrientation = &shared.m_DomesticOrientation[first];
+        batch.m_WageLevel = &m_WageLevel[first];
+        batch.m_LaborIntensity = &shared.m_LaborIntensity[first];
+        batch.m_Debt = &m_Debt[first];
+        batch.m_Sectors = &shared.m_Sectors[first];
+        batch.m_Sizes = &shared.m_Sizes[first];
+        batch.m_Revenue = &m_LastRevenue[first];
+        batch.m_Profitability = &m_Profitability[first];
+        return batch;
+    };
+
+    // Rows are sorted into sector x size runs (SortByBucket). Long runs take
+    // the bucket kernel; short ones in between are batched together.
+    size_t mixedBegin = begin;
+    size_t runBegin = begin;
+    while (runBegin < end)
+    {
+        size_t runEnd = runBegin + 1;
+        while (runEnd < end && shared.m_Sectors[runEnd] == shared.m_Sectors[runBegin] &&
+               shared.m_Sizes[runEnd] == shared.m_Sizes[runBegin])
+        {
+            ++runEnd;
+        }
+
+        if (runEnd - runBegin >= MIN_BUCKET_RUN)
+        {
+            if (mixedBegin < runBegin)
+            {
+                CCompanyKernels::ComputeFinancials(makeBatch(mixedBegin, runBegin), coefficients);
+            }
+            CCompanyKernels::ComputeFinancialsBucket(makeBatch(runBegin, runEnd), coefficients);
+            mixedBegin = runEnd;
+        }
+        runBegin = runEnd;
+    }
+
+    if (mixedBegin < end)
+    {
+        CCompanyKernels::ComputeFinancials(makeBatch(mixedBegin, end), coefficients);
+    }
+}
+
+void CCompanyStore::UpdateLiquidity(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        m_Liquidity[i] += m_Profitability[i];
+    }
+}
+
+void CCompanyStore::UpdateHistory(size_t begin, size_t end)
+{
+    // One contiguous run per metric in this month's column
+    m_History.Record(EHistoryMetric::Profit, begin, end, &m_Profitability[begin]);
+    m_History.Record(EHistoryMetric::Employees, begin, end, &m_Employees[begin]);
+    m_History.Record(EHistoryMetric::Liquidity, begin, end, &m_Liquidity[begin]);
+    m_History.Record(EHistoryMetric::Revenue, begin, end, &m_LastRevenue[begin]);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        // Smoothed profit is updated in place, so expectations never read history
+        m_AverageProfit[i] += m_ExpectationSmoothing * (m_Profitability[i] - m_AverageProfit[i]);
+    }
+}
+
+void CCompanyStore::UpdateExpectations(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        // Expectation = current trend + momentum
+        // (new companies start from a zero average, like an empty history)
+        float profitability = m_Profitability[i];
+        float avgProfit = m_AverageProfit[i];
+        float trend = (profitability - avgProfit) / (std::abs(avgProfit) + 0.1f);
+        m_ExpectedProfit[i] = profitability * (1.0f + trend * 0.3f);
+
+        // Update perceived risk
+        float liquidity = m_Liquidity[i];
+        if (liquidity < 50.0f)
+        {
+            m_PerceivedRisk[i] = 0.8f;
+        }
+        else if (liquidity < 200.0f)
+        {
+            m_PerceivedRisk[i] = 0.5f;
+        }
+        else
+        {
+            m_PerceivedRisk[i] = 0.2f;
+        }
+    }
+}
+
+void CCompanyStore::MakeDecisions(size_t begin, size_t end, const SPolicyParams& policy, const SMacroState& macro,
+                                  const SSimulationTick& tick)
+{
+    const SSharedColumns& shared = *m_Shared;
+
+    // Reinvestment rolls for the block, keyed by company ID so a company
+    // draws the same number regardless of its slot or thread
+    uint32_t reinvestmentRolls[SIMULATION_BLOCK_SIZE];
+    CCounterRNG::Next32Batch(tick.m_WorldSeed, &shared.m_IDs[begin], end - begin, tick.m_Tick,
+                             ERandomStream::Reinvestment, reinvestmentRolls);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        // Decision tree based on profitability and expectations
+        float& liquidity = m_Liquidity[i];
+        float& debt = m_Debt[i];
+        int32_t& employees = m_Employees[i];
+        float& wageLevel = m_WageLevel[i];
+        float& capacityUtilization = m_CapacityUtilization[i];
+        ECompanyState& companyState = m_States[i];
+        float profitability = m_Profitability[i];
+        float expectedProfit = m_ExpectedProfit[i];
+
+        // Check market saturation before hiring
+        int32_t sectorIndex = static_cast<int32_t>(shared.m_Sectors[i]);
+        float saturation = macro.m_SectorSaturation[sectorIndex];
+
+        // High profit + positive expectations + MARKET NOT SATURATED = EXPAND
+        if (expectedProfit > 10.0f &&
+            liquidity > 200.0f &&
+            saturation < 0.85f) // Can't grow if market is 85%+ saturated
+        {
+            companyState = ECompanyState::Growing;
+
+            // Growth rate reduced by saturation (companies can't grow fast in saturated markets)
+            float growthPotential = std::max(0.0f, 1.0f - (saturation * 1.5f));
+            int32_t newHires = static_cast<int32_t>(employees * 0.05f * growthPotential);
+            employees += newHires;
+
+            // Increase capacity utilization (slower in saturated markets)
+            capacityUtilization = std::min(1.0f, capacityUtilization + 0.05f * growthPotential);
+
+            // Increase wages slightly to attract workers (only if not already high)
+            if (wageLevel < policy.m_MinimumWage * 3.0f)
+            {
+                wageLevel *= 1.005f;  // 0.5% increase instead of 2%
+            }
+        }
+        // Moderate profit + neutral expectations = STABLE
+        else if (profitability > 0.0f && expectedProfit > -5.0f)
+        {
+            companyState = ECompanyState::Stable;
+
+            // Maintain current size
+            // Small adjustments to capacity
+            if (capacityUtilization > 0.95f)
+            {
+                capacityUtilization = 0.95f;
+            }
+        }
+        // Low profit + negative expectations = DECLINE
+        // Increased threshold from -5.0f to -15.0f to avoid premature layoffs
+        else if (profitability < -15.0f || expectedProfit < -20.0f)
+        {
+            companyState = ECompanyState::Declining;
+
+            // Layoffs (5% reduction)
+            int32_t layoffs = static_cast<int32_t>(employees * 0.05f);
+            employees = std::max(1, employees - layoffs);
+
+            // Reduce capacity
+            capacityUtilization = std::max(0.5f, capacityUtilization - 0.05f);
+
+            // Freeze or reduce wages
+            if (wageLevel > policy.m_MinimumWage)
+            {
+                wageLevel *= 0.98f;
+            }
+        }
+
+        // Crisis: Very low liquidity
+        if (liquidity < 20.0f)
+        {
+            companyState = ECompanyState::Crisis;
+
+            // Emergency layoffs (10%)
+            int32_t emergencyLayoffs = static_cast<int32_t>(employees * 0.1f);
+            employees = std::max(1, employees - emergencyLayoffs);
+
+            // Take debt if possible
+            if (debt < liquidity * 2.0f)
+            {
+                debt += 50.0f;  // Borrow 50k
+                liquidity += 50.0f;
+            }
+
+            // Consider informalization (evade regulations)
+            if (policy.m_LaborRegulationBurden > 0.5f && shared.m_Sizes[i] <= ECompanySize::Small)
+            {
+                m_FormalityLevel[i] = std::max(0.0f, m_FormalityLevel[i] - 0.1f);
+            }
+        }
+        else
+        {
+            // Recover formality if conditions improve
+            if (policy.m_LaborRegulationBurden < 0.3f && m_FormalityLevel[i] < 1.0f)
+            {
+                m_FormalityLevel[i] = std::min(1.0f, m_FormalityLevel[i] + 0.05f);
+            }
+        }
+
+        // Ensure wage doesn't go below minimum
+        if (wageLevel < policy.m_MinimumWage)
+        {
+            wageLevel = policy.m_MinimumWage;
+        }
+
+        // Capital allocation - distribute excess liquidity as dividends or reinvest
+        if (liquidity > 100.0f)  // Only if significant liquidity
+        {
+            // Calculate target liquidity (6 months operating expenses)
+            float monthlyExpenses = static_cast<float>(employees) *
+                                    wageLevel * 160.0f / 1000.0f;
+            float targetLiquidity = monthlyExpenses * 6.0f;
+
+            float excessLiquidity = liquidity - targetLiquidity;
+
+            if (excessLiquidity > 0.0f && profitability > 0.0f)
+            {
+                // Dividend rate based on company state
+                float dividendRate = 0.5f;  // Default 50%
+
+                switch (companyState)
+                {
+                    case ECompanyState::Growing:
+                        dividendRate = 0.4f;  // Retain more for growth
+                        break;
+                    case ECompanyState::Stable:
+                        dividendRate = 0.7f;  // Balanced distribution
+                        break;
+                    case ECompanyState::Declining:
+                        dividendRate = 0.2f;  // Conserve cash
+                        break;
+                    case ECompanyState::Crisis:
+                        dividendRate = 0.0f;  // Keep everything
+                        break;
+                }
+
+                float dividends = excessLiquidity * dividendRate;
+                liquidity -= dividends;
+
+                // Growing companies: 30% chance to reinvest for productivity boost
+                if (companyState == ECompanyState::Growing && CCounterRNG::ToRange(reinvestmentRolls[i - begin], 100) < 30)
+                {
+                    float investment = excessLiquidity * 0.3f;
+                    m_BaseProductivity[i] *= 1.03f;  // 3% boost
+                    liquidity -= investment;
+                }
+            }
+        }
+    }
+}
+
+void CCompanyStore::CheckBankruptcy(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        // Bankruptcy if liquidity is very negative for multiple periods
+        if (m_Liquidity[i] < BANKRUPTCY_LIQUIDITY)
+        {
+            // Stop operations; the firm closes when the month commits
+            // (see CFirmDynamics) unless firm dynamics are off
+            m_States[i] = ECompanyState::Crisis;
+            m_Employees[i] = 0;
+            m_CapacityUtilization[i] = 0.0f;
+        }
+    }
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,137 @@
+#include "Economy/CCompanyTableIndex.h"
+#include <algorithm>
+#include <bit>
+
+namespace PoliticSim {
+
+namespace {
+
+// Order-preserving map of a float onto uint32 (negatives flip all bits,
+// positives flip the sign bit)
+uint32_t FloatKey(float value)
+{
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+}
+
+bool IsListed(uint32_t mask, uint8_t value)
+{
+    return value < 32 && (mask >> value & 1u) != 0;
+}
+
+} // namespace
+
+CCompanyTableIndex::CCompanyTableIndex()
+    : m_Query()
+    , m_Rows()
+    , m_Keys()
+    , m_SortBuffer()
+    , m_BuiltTick(0)
+    , m_Dirty(true)
+{
+}
+
+void CCompanyTableIndex::SetQuery(const SCompanyTableQuery& query)
+{
+    if (!(query == m_Query))
+    {
+        m_Query = query;
+        m_Dirty = true;
+    }
+}
+
+uint32_t CCompanyTableIndex::GetSortKey(const SEconomySnapshot& snapshot, ECompanyTableColumn column, size_t row)
+{
+    switch (column)
+    {
+        case ECompanyTableColumn::ID: return snapshot.m_IDs[row];
+        case ECompanyTableColumn::Sector: return static_cast<uint32_t>(snapshot.m_Sectors[row]);
+        case ECompanyTableColumn::Size: return static_cast<uint32_t>(snapshot.m_Sizes[row]);
+        case ECompanyTableColumn::Employees: return static_cast<uint32_t>(snapshot.m_Employees[row]) ^ 0x80000000u;
+        case ECompanyTableColumn::Profit: return FloatKey(snapshot.m_Profitability[row]);
+        case ECompanyTableColumn::Liquidity: return FloatKey(snapshot.m_Liquidity[row]);
+        case ECompanyTableColumn::State: return static_cast<uint32_t>(snapshot.m_States[row]);
+        case ECompanyTableColumn::COUNT: break;
+    }
+    return 0;
+}
+
+void CCompanyTableIndex::SortKeys()
+{
+    // Three passes of 11 bits; several times faster than std::sort at a
+    // million rows
+    constexpr uint32_t DIGIT_BITS = 11;
+    constexpr uint32_t DIGIT_COUNT = 1u << DIGIT_BITS;
+
+    m_SortBuffer.resize(m_Keys.size());
+    size_t counts[DIGIT_COUNT];
+    for (uint32_t shift = 32; shift < 64; shift += DIGIT_BITS)
+    {
+        std::fill(std::begin(counts), std::end(counts), 0);
+        for (uint64_t key : m_Keys)
+        {
+            counts[key >> shift & (DIGIT_COUNT - 1)]++;
+        }
+
+        // A digit every key shares leaves the order as it is
+        if (counts[m_Keys.empty() ? 0 : m_Keys[0] >> shift & (DIGIT_COUNT - 1)] == m_Keys.size())
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t& count : counts)
+        {
+            size_t digitCount = count;
+            count = offset;
+            offset += digitCount;
+        }
+        for (uint64_t key : m_Keys)
+        {
+            m_SortBuffer[counts[key >> shift & (DIGIT_COUNT - 1)]++] = key;
+        }
+        m_Keys.swap(m_SortBuffer);
+    }
+}
+
+bool CCompanyTableIndex::Update(const SEconomySnapshot& snapshot)
+{
+    if (!m_Dirty && snapshot.m_Tick == m_BuiltTick)
+    {
+        return false;
+    }
+
+    // One 64-bit key per listed row; the sort is stable, so equal column
+    // values keep snapshot order
+    m_Keys.clear();
+    size_t count = snapshot.GetCompanyCount();
+    for (size_t row = 0; row < count; ++row)
+    {
+        if (!IsListed(m_Query.m_SectorMask, static_cast<uint8_t>(snapshot.m_Sectors[row])) ||
+            !IsListed(m_Query.m_SizeMask, static_cast<uint8_t>(snapshot.m_Sizes[row])) ||
+            !IsListed(m_Query.m_StateMask, static_cast<uint8_t>(snapshot.m_States[row])))
+        {
+            continue;
+        }
+
+        uint32_t key = GetSortKey(snapshot, m_Query.m_SortColumn, row);
+        if (m_Query.m_Descending)
+        {
+            key = ~key;
+        }
+        m_Keys.push_back(static_cast<uint64_t>(key) << 32 | row);
+    }
+    SortKeys();
+
+    m_Rows.resize(m_Keys.size());
+    for (size_t i = 0; i < m_Keys.size(); ++i)
+    {
+        m_Rows[i] = static_cast<uint32_t>(m_Keys[i]);
+    }
+
+    m_BuiltTick = snapshot.m_Tick;
+    m_Dirty = false;
+    return true;
+}
+
+} // namespace PoliticSim
@@ -1,49 +1,316 @@
 #include "Economy/CEconomyManager.h"
-#include "Economy/CCompany.h"
+#include "Economy/CStateHash.h"
 #include "Time/CTimeUnits.h"
+#include "Save/CConfigChunks.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
-#include <random>
 
 namespace PoliticSim {
 
-CEconomyManager::CEconomyManager()
-    : m_Companies()
+namespace {
+
+// Company sizes are drawn from a roll in [0, SIZE_ROLLS)
+constexpr uint32_t SIZE_ROLLS = 4;
+
+// Size of a rolled company (weighted toward smaller companies)
+ECompanySize SizeFromRoll(int32_t sizeRoll)
+{
+    if (sizeRoll == 0)
+        return ECompanySize::Micro;
+    else if (sizeRoll <= 2)
+        return ECompanySize::Small;
+    else if (sizeRoll == 3)
+        return ECompanySize::Medium;
+    else
+        return ECompanySize::Large;
+}
+
+} // namespace
+
+CEconomyManager::CEconomyManager(size_t threadCount)
+    : m_Config()
+    , m_Companies()
+    , m_Clusters()
+    , m_Sampling()
+    , m_LOD()
+    , m_FirmDynamics()
+    , m_CompanyIDs()
+    , m_Regions()
+    , m_Journal()
     , m_PolicyParams()
     , m_MacroState()
-    , m_NextCompanyID(1)
     , m_SimulationAccumulator(0.0f)
+    , m_TickBudgetSeconds(DEFAULT_TICK_BUDGET_SECONDS)
+    , m_LastFrameTicks(0)
+    , m_TimeSlicing(false)
+    , m_SliceActive(false)
+    , m_SliceTask(0)
+    , m_SliceRow(0)
+    , m_SliceRowsDone(0)
+    , m_SlicePolicy()
+    , m_Tick(0)
+    , m_RepresentedCompanies(0.0)
     , m_TotalEmployment(0.0f)
     , m_TotalGDP(0.0f)
     , m_AverageProfitability(0.0f)
+    , m_WorkerPool(std::make_unique<CWorkerPool>(threadCount > 0 ? threadCount : CWorkerPool::GetDefaultThreadCount()))
 {
 }
 
-CEconomyManager::~CEconomyManager()
+void CEconomyManager::Initialize(const SEconomyConfig& config)
 {
-    // Empty - unique_ptr handles cleanup automatically
-    // This must be in .cpp where CCompany is fully defined
-}
+    std::cout << "Economy Manager: Initializing (seed " << config.m_WorldSeed << ")..." << std::endl;
 
-void CEconomyManager::Initialize()
-{
-    std::cout << "Economy Manager: Initializing..." << std::endl;
+    m_Config = config;
+    m_CompanyIDs.Reset();
+    m_SimulationAccumulator = 0.0f;
+    m_LastFrameTicks = 0;
+    m_SliceActive = false;
+    m_Tick = 0;
 
-    // Create 250 companies across sectors and sizes
+    // Every company row needs a live ID
+    if (m_Config.m_CompanyCount > static_cast<int32_t>(CCompanyIDAllocator::MAX_LIVE_IDS))
+    {
+        std::cerr << "Economy Manager: " << m_Config.m_CompanyCount << " companies exceed the "
+                  << CCompanyIDAllocator::MAX_LIVE_IDS << " company IDs, creating " << CCompanyIDAllocator::MAX_LIVE_IDS
+                  << std::endl;
+        m_Config.m_CompanyCount = static_cast<int32_t>(CCompanyIDAllocator::MAX_LIVE_IDS);
+    }
+
+    SetWorkerThreadCount(m_Config.m_WorkerThreads);
+    m_Companies.Clear();
+    m_Companies.ConfigureHistory(m_Config.m_History);
+    m_Companies.SetExpectationWindow(m_Config.m_ExpectationMonths);
+
+    // Create companies across regions, sectors and sizes
+    m_Regions.Configure(m_Config.m_Regions);
     InitializeCompanies();
+    m_Companies.SortByBucket();
+    InitializeClusters();
+    RebuildRegionTasks();
+
+    // The starting row count is the compute budget for the whole run
+    m_LOD.Configure(m_Config.m_LOD, m_Companies.GetCount());
+    m_FirmDynamics.Configure(m_Config.m_FirmDynamics);
 
     // Calculate initial macro state
     UpdateMacroState();
 
-    std::cout << "Economy Manager: Initialized (" << m_Companies.size() << " companies)" << std::endl;
+    // A new world restarts a running journal from its month 0
+    if (m_Journal.IsRecording())
+    {
+        m_Journal.Start(m_Config, m_PolicyParams);
+    }
+
+    std::cout << "Economy Manager: Initialized (" << m_Companies.GetCount() << " companies)" << std::endl;
 }
 
 void CEconomyManager::Shutdown()
 {
     std::cout << "Economy Manager: Shutting down..." << std::endl;
-    m_Companies.clear();
+    m_Companies.Clear();
+    m_Clusters.clear();
     std::cout << "Economy Manager: Shutdown complete" << std::endl;
 }
 
+bool CEconomyManager::SaveState(const std::string& path) const
+{
+    if (m_SliceActive)
+    {
+        std::cerr << "Economy Manager: cannot save while a time-sliced month is in progress" << std::endl;
+        return false;
+    }
+
+    CSaveWriter writer;
+    if (!writer.Open(path))
+    {
+        return false;
+    }
+
+    // World recipe, clock and economy-wide state
+    writer.BeginChunk(SSaveFormat::MakeTag("ECON"));
+    CConfigChunks::WriteConfig(writer, m_Config);
+
+    writer.Write(m_Tick);
+    writer.Write(m_SimulationAccumulator);
+    CConfigChunks::WritePolicy(writer, m_PolicyParams);
+    writer.Write(m_MacroState);
+    writer.Write(m_RepresentedCompanies);
+    writer.Write(m_TotalEmployment);
+    writer.Write(m_TotalGDP);
+    writer.Write(m_AverageProfitability);
+    writer.EndChunk();
+
+    m_Companies.Save(writer);
+
+    writer.BeginChunk(SSaveFormat::MakeTag("CLUS"));
+    writer.Write(static_cast<uint32_t>(m_Clusters.size()));
+    for (const CCompanyCluster& cluster : m_Clusters)
+    {
+        cluster.Save(writer);
+    }
+    writer.EndChunk();
+
+    m_Sampling.Save(writer);
+    m_LOD.Save(writer);
+    m_Regions.Save(writer);
+    m_CompanyIDs.Save(writer);
+    return writer.Close();
+}
+
+bool CEconomyManager::LoadState(const std::string& path)
+{
+    std::cout << "Economy Manager: Loading " << path << "..." << std::endl;
+
+    CSaveReader reader;
+    if (!reader.Open(path) || !reader.BeginChunk(SSaveFormat::MakeTag("ECON")))
+    {
+        return false;
+    }
+
+    // Read the economy-wide section completely before touching anything.
+    // The worker pool is a property of this process and stays as it is.
+    SEconomyConfig config;
+    config.m_WorkerThreads = m_Config.m_WorkerThreads;
+    CConfigChunks::ReadConfig(reader, config);
+
+    uint32_t tick = reader.Read<uint32_t>();
+    float accumulator = reader.Read<float>();
+    SPolicyParams policy;
+    CConfigChunks::ReadPolicy(reader, policy);
+    SMacroState macro = reader.Read<SMacroState>();
+    double represented = reader.Read<double>();
+    float employment = reader.Read<float>();
+    float gdp = reader.Read<float>();
+    float averageProfitability = reader.Read<float>();
+    reader.EndChunk();
+
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+
+    m_Config = config;
+    m_Tick = tick;
+    m_SimulationAccumulator = accumulator;
+    m_PolicyParams = policy;
+    m_MacroState = macro;
+    m_RepresentedCompanies = represented;
+    m_TotalEmployment = employment;
+    m_TotalGDP = gdp;
+    m_AverageProfitability = averageProfitability;
+    m_LastFrameTicks = 0;
+    m_SliceActive = false;
+
+    // A journal replays from a seed, which a loaded world no longer matches
+    if (m_Journal.IsRecording())
+    {
+        std::cout << "Economy Manager: Journal stopped (loaded worlds cannot be replayed from the seed)" << std::endl;
+        m_Journal.Stop();
+    }
+
+    m_Regions.Configure(m_Config.m_Regions);
+    m_FirmDynamics.Configure(m_Config.m_FirmDynamics);
+
+    bool loaded = m_Companies.Load(reader);
+    if (loaded && reader.BeginChunk(SSaveFormat::MakeTag("CLUS")))
+    {
+        uint32_t count = reader.Read<uint32_t>();
+        m_Clusters.clear();
+        for (uint32_t i = 0; i < count && loaded; ++i)
+        {
+            m_Clusters.emplace_back(0, 0, SClusterConfig(), SCompanyAttributes());
+            loaded = m_Clusters.back().Load(reader);
+        }
+        reader.EndChunk();
+    }
+    loaded = loaded && m_Sampling.Load(reader) && m_LOD.Load(reader) && m_Regions.Load(reader) &&
+             m_CompanyIDs.Load(reader);
+
+    // Every row must belong to a leaf of this hierarchy, and every open
+    // company must hold a live ID
+    const uint16_t* regions = m_Companies.GetRegions();
+    const uint32_t* ids = m_Companies.GetIDs();
+    for (size_t i = 0; loaded && i < m_Companies.GetCount(); ++i)
+    {
+        if (regions[i] >= m_Regions.GetLeafCount())
+        {
+            reader.Fail("company in an unknown region");
+            loaded = false;
+        }
+        else if (!m_Companies.IsClosed(i) && !m_CompanyIDs.IsAlive(ids[i]))
+        {
+            reader.Fail("company ID not in the ID pool");
+            loaded = false;
+        }
+    }
+    for (const CCompanyCluster& cluster : m_Clusters)
+    {
+        if (loaded && cluster.GetRegion() >= m_Regions.GetLeafCount())
+        {
+            reader.Fail("cluster in an unknown region");
+            loaded = false;
+        }
+    }
+
+    if (!loaded || !reader.IsGood())
+    {
+        std::cerr << "Economy Manager: " << path << " could not be loaded, economy cleared" << std::endl;
+        m_Companies.Clear();
+        m_Clusters.clear();
+        m_CompanyIDs.Reset();
+        m_Tick = 0;
+        m_SimulationAccumulator = 0.0f;
+        m_Regions.Configure(std::vector<SRegionConfig>());
+        RebuildRegionTasks();
+        return false;
+    }
+
+    // Saved rows are already grouped by region (this only checks). They are
+    // not re-bucketed, so a loaded run continues row for row.
+    m_Companies.SortByRegion();
+    RebuildRegionTasks();
+
+    std::cout << "Economy Manager: Loaded " << m_Companies.GetCount() << " companies at month " << m_Tick << std::endl;
+    return true;
+}
+
+std::unique_ptr<CEconomyManager> CEconomyManager::Fork() const
+{
+    auto fork = std::make_unique<CEconomyManager>(1);
+    fork->m_Config = m_Config;
+    fork->m_Config.m_WorkerThreads = 1;
+    fork->m_Companies = m_Companies.Fork();
+    fork->m_Clusters = m_Clusters;
+    fork->m_Sampling = m_Sampling;
+    fork->m_LOD = m_LOD;
+    fork->m_FirmDynamics = m_FirmDynamics;
+    fork->m_CompanyIDs = m_CompanyIDs;
+    fork->m_Regions = m_Regions;
+    fork->m_PolicyParams = m_PolicyParams;
+    fork->m_MacroState = m_MacroState;
+
+    // Rows already done in a sliced month hold next month's values
+    fork->m_SliceActive = m_SliceActive;
+    fork->m_SliceTask = m_SliceTask;
+    fork->m_SliceRow = m_SliceRow;
+    fork->m_SliceRowsDone = m_SliceRowsDone;
+    fork->m_SlicePolicy = m_SlicePolicy;
+
+    fork->m_Tick = m_Tick;
+    fork->m_RepresentedCompanies = m_RepresentedCompanies;
+    fork->m_TotalEmployment = m_TotalEmployment;
+    fork->m_TotalGDP = m_TotalGDP;
+    fork->m_AverageProfitability = m_AverageProfitability;
+
+    fork->m_RegionTasks = m_RegionTasks;
+    fork->m_LeafFirstTask = m_LeafFirstTask;
+    return fork;
+}
+
 void CEconomyManager::Update(float gameDelta)
 {
     // Accumulate game time
@@ -51,181 +318,676 @@ void CEconomyManager::Update(float gameDelta)
     float gameDays = gameDelta / static_cast<float>(CTimeUnits::SECONDS_PER_DAY);
     m_SimulationAccumulator += gameDays;
 
-    // When we've accumulated 30 days, run a simulation tick
-    if (m_SimulationAccumulator >= 30.0f)
+    if (m_TimeSlicing)
+    {
+        UpdateSliced();
+        return;
+    }
+
+    // Run every month that is owed until this frame's tick budget is spent.
+    // At least one month runs per frame so the economy always progresses;
+    // whatever is left carries over to the next frame as lag.
+    const float daysPerMonth = static_cast<float>(CTimeUnits::DAYS_PER_MONTH);
+    auto start = std::chrono::steady_clock::now();
+    m_LastFrameTicks = 0;
+
+    while (m_SimulationAccumulator >= daysPerMonth)
     {
-        SimulateAllCompanies();
-        UpdateMacroState();
-        m_SimulationAccumulator -= 30.0f;
+        AdvanceMonth();
+        m_SimulationAccumulator -= daysPerMonth;
+        m_LastFrameTicks++;
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= m_TickBudgetSeconds)
+        {
+            break;
+        }
     }
 }
 
-void CEconomyManager::InitializeCompanies()
+void CEconomyManager::UpdateSliced()
 {
-    // Create 250 companies across sectors and sizes
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> sectorDist(0, static_cast<int32_t>(ESector::COUNT) - 1);
-    std::uniform_int_distribution<> sizeDist(0, 3);
-
-    for (int32_t i = 0; i < 250; ++i)
-    {
-        // Random sector
-        ESector sector = static_cast<ESector>(sectorDist(gen));
-
-        // Random size (weighted toward smaller companies)
-        int32_t sizeRoll = sizeDist(gen);
-        ECompanySize size;
-        if (sizeRoll == 0)
-            size = ECompanySize::Micro;
-        else if (sizeRoll <= 2)
-            size = ECompanySize::Small;
-        else if (sizeRoll == 3)
-            size = ECompanySize::Medium;
-        else
-            size = ECompanySize::Large;
-
-        // Create attributes based on sector
-        SCompanyAttributes attrs;
-        attrs.m_Sector = sector;
-        attrs.m_Size = size;
-
-        // Sector-specific attributes
-        // Productivity: Revenue generated per employee per month (in thousands)
-        // Balanced for ~15-25% profit margin with neutral policies
-        switch (sector)
-        {
-            case ESector::Agriculture:
-                attrs.m_BaseProductivity = 18.0f;  // Lower value-added
-                attrs.m_LaborIntensity = 0.8f;
-                attrs.m_MarketCompetitiveness = 0.6f;
-                break;
-            case ESector::Industry:
-                attrs.m_BaseProductivity = 32.0f;  // Manufacturing efficiency
-                attrs.m_LaborIntensity = 0.4f;
-                attrs.m_MarketCompetitiveness = 0.5f;
-                break;
-            case ESector::Services:
-                attrs.m_BaseProductivity = 22.0f;  // Service-based
-                attrs.m_LaborIntensity = 0.7f;
-                attrs.m_MarketCompetitiveness = 0.8f;
-                break;
-            case ESector::Technology:
-                attrs.m_BaseProductivity = 45.0f;  // High value-added
-                attrs.m_LaborIntensity = 0.3f;
-                attrs.m_MarketCompetitiveness = 0.6f;
-                break;
-            case ESector::Retail:
-                attrs.m_BaseProductivity = 20.0f;  // Volume-based, low margin
-                attrs.m_LaborIntensity = 0.9f;
-                attrs.m_MarketCompetitiveness = 0.9f;
+    // Rows are simulated as their share of the month's game time arrives,
+    // so one month's work is spread over the frames leading up to it. The
+    // month commits once it is owed and every row is done.
+    const float daysPerMonth = static_cast<float>(CTimeUnits::DAYS_PER_MONTH);
+    auto start = std::chrono::steady_clock::now();
+    m_LastFrameTicks = 0;
+
+    while (true)
+    {
+        size_t rowCount = m_Companies.GetCount();
+        bool owed = m_SimulationAccumulator >= daysPerMonth;
+        size_t step = TIME_SLICE_COMPANIES;
+
+        if (!owed)
+        {
+            // Never the last row: that would commit the month early
+            size_t due = static_cast<size_t>(static_cast<double>(rowCount) * m_SimulationAccumulator / daysPerMonth);
+            due = std::min(due, rowCount > 0 ? rowCount - 1 : 0);
+            size_t done = m_SliceActive ? m_SliceRowsDone : 0;
+            if (done >= due)
+            {
                 break;
+            }
+            step = std::min(step, due - done);
+        }
+
+        if (AdvanceMonthSliced(step))
+        {
+            m_SimulationAccumulator -= daysPerMonth;
+            m_LastFrameTicks++;
+        }
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= m_TickBudgetSeconds)
+        {
+            break;
+        }
+    }
+}
+
+int32_t CEconomyManager::GetPendingMonths() const
+{
+    return static_cast<int32_t>(m_SimulationAccumulator / static_cast<float>(CTimeUnits::DAYS_PER_MONTH));
+}
+
+void CEconomyManager::AdvanceMonth()
+{
+    // A time-sliced month already has rows done; finish that month instead
+    if (m_SliceActive)
+    {
+        AdvanceMonthSliced(m_Companies.GetCount());
+        return;
+    }
+
+    SimulateAllCompanies();
+    CommitMonth(m_PolicyParams);
+}
+
+bool CEconomyManager::AdvanceMonthSliced(size_t companies)
+{
+    if (!m_SliceActive)
+    {
+        // Freeze the month's inputs. Regional macro states only change when
+        // a month commits, so the policy is the one that needs a copy.
+        m_SlicePolicy = m_PolicyParams;
+        m_SliceTask = 0;
+        m_SliceRow = m_RegionTasks.empty() ? 0 : m_RegionTasks[0].m_Begin;
+        m_SliceRowsDone = 0;
+        m_SliceActive = true;
+    }
+
+    // Rows only write their own slots, so simulating them in any number of
+    // slices gives the same month as SimulateAllCompanies
+    SSimulationTick tick(m_Config.m_WorldSeed, m_Tick);
+    size_t budget = std::max<size_t>(companies, 1);
+
+    while (m_SliceTask < m_RegionTasks.size() && budget > 0)
+    {
+        const SRegionTask& task = m_RegionTasks[m_SliceTask];
+        size_t end = std::min(task.m_End, m_SliceRow + budget);
+        m_Companies.SimulateRange(m_SliceRow, end, m_SlicePolicy, m_Regions.GetLeafMacroState(task.m_Leaf), tick);
+
+        budget -= end - m_SliceRow;
+        m_SliceRowsDone += end - m_SliceRow;
+        m_SliceRow = end;
+
+        if (m_SliceRow == task.m_End && ++m_SliceTask < m_RegionTasks.size())
+        {
+            m_SliceRow = m_RegionTasks[m_SliceTask].m_Begin;
+        }
+    }
+
+    if (m_SliceTask < m_RegionTasks.size())
+    {
+        return false;
+    }
+
+    // Every row is done: commit the month in one step
+    m_Companies.AdvanceHistory();
+    SimulateClusters(m_SlicePolicy, tick);
+    m_SliceActive = false;
+    CommitMonth(m_SlicePolicy);
+    return true;
+}
+
+float CEconomyManager::GetMonthProgress() const
+{
+    if (!m_SliceActive || m_Companies.IsEmpty())
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(m_SliceRowsDone) / static_cast<float>(m_Companies.GetCount());
+}
+
+float CEconomyManager::GetProfitMargin() const
+{
+    return CFirmDynamics::GetProfitMargin(static_cast<double>(m_AverageProfitability) * m_RepresentedCompanies,
+                                          static_cast<double>(m_TotalGDP));
+}
+
+void CEconomyManager::CommitMonth(const SPolicyParams& policy)
+{
+    UpdateFirmPopulation();
+    ReviewLevelOfDetail();
+    UpdateMacroState(policy);
+    m_Tick++;
+
+    if (m_Journal.IsRecording())
+    {
+        m_Journal.RecordStateHash(ComputeStateHash());
+    }
+}
+
+void CEconomyManager::SetPolicyParams(const SPolicyParams& policy)
+{
+    if (m_Journal.IsRecording())
+    {
+        // A sliced month in progress keeps the policy it started with
+        m_Journal.RecordPolicy(m_SliceActive ? m_Tick + 1 : m_Tick, m_PolicyParams, policy);
+    }
+    m_PolicyParams = policy;
+}
+
+bool CEconomyManager::StartJournal()
+{
+    if (m_Tick != 0 || m_SliceActive)
+    {
+        std::cerr << "Economy Manager: a journal must start at month 0 (now month " << m_Tick << ")" << std::endl;
+        return false;
+    }
+    m_Journal.Start(m_Config, m_PolicyParams);
+    return true;
+}
+
+uint64_t CEconomyManager::ComputeStateHash() const
+{
+    CStateHash hash;
+    hash.Add(m_Tick);
+    m_Companies.HashState(hash);
+    m_CompanyIDs.HashState(hash);
+    for (const CCompanyCluster& cluster : m_Clusters)
+    {
+        cluster.HashState(hash);
+    }
+
+    hash.Add(m_MacroState);
+    for (int32_t region = 0; region < m_Regions.GetRegionCount(); ++region)
+    {
+        hash.Add(m_Regions.GetMacroState(region));
+    }
+    hash.Add(m_RepresentedCompanies);
+    hash.Add(m_TotalEmployment);
+    hash.Add(m_TotalGDP);
+    hash.Add(m_AverageProfitability);
+    return hash.GetValue();
+}
+
+void CEconomyManager::SetWorkerThreadCount(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = CWorkerPool::GetDefaultThreadCount();
+    }
+
+    if (threadCount != m_WorkerPool->GetThreadCount())
+    {
+        m_WorkerPool = std::make_unique<CWorkerPool>(threadCount);
+    }
+}
+
+SCompanyAttributes CEconomyManager::MakeSectorAttributes(ESector sector, ECompanySize size)
+{
+    SCompanyAttributes attrs;
+    attrs.m_Sector = sector;
+    attrs.m_Size = size;
+
+    // Sector-specific attributes
+    // Productivity: Revenue generated per employee per month (in thousands)
+    // Balanced for ~15-25% profit margin with neutral policies
+    switch (sector)
+    {
+        case ESector::Agriculture:
+            attrs.m_BaseProductivity = 18.0f;  // Lower value-added
+            attrs.m_LaborIntensity = 0.8f;
+            attrs.m_MarketCompetitiveness = 0.6f;
+            break;
+        case ESector::Industry:
+            attrs.m_BaseProductivity = 32.0f;  // Manufacturing efficiency
+            attrs.m_LaborIntensity = 0.4f;
+            attrs.m_MarketCompetitiveness = 0.5f;
+            break;
+        case ESector::Services:
+            attrs.m_BaseProductivity = 22.0f;  // Service-based
+            attrs.m_LaborIntensity = 0.7f;
+            attrs.m_MarketCompetitiveness = 0.8f;
+            break;
+        case ESector::Technology:
+            attrs.m_BaseProductivity = 45.0f;  // High value-added
+            attrs.m_LaborIntensity = 0.3f;
+            attrs.m_MarketCompetitiveness = 0.6f;
+            break;
+        case ESector::Retail:
+            attrs.m_BaseProductivity = 20.0f;  // Volume-based, low margin
+            attrs.m_LaborIntensity = 0.9f;
+            attrs.m_MarketCompetitiveness = 0.9f;
+            break;
+        case ESector::COUNT:
+            break;
+    }
+
+    return attrs;
+}
+
+void CEconomyManager::InitializeCompanies()
+{
+    m_Sampling.Clear();
+    if (m_Config.m_Sampling.m_RepresentedCompanies > m_Config.m_CompanyCount)
+    {
+        InitializeSampledCompanies();
+        return;
+    }
+
+    // Create companies across sectors and sizes, region by region
+    m_Companies.Reserve(static_cast<size_t>(std::max(m_Config.m_CompanyCount, 0)));
+    std::vector<int64_t> leafCounts = m_Regions.SplitByShare(std::max(m_Config.m_CompanyCount, 0));
+
+    for (int32_t leaf = 0; leaf < m_Regions.GetLeafCount(); ++leaf)
+    {
+        for (int64_t i = 0; i < leafCounts[leaf]; ++i)
+        {
+            // Draws are keyed by the new company's ID, so the layout depends only on the seed
+            uint32_t id = m_CompanyIDs.Allocate();
+            if (id == CCompanyIDAllocator::INVALID_ID)
+            {
+                return;
+            }
+            CCounterRNG::Block draws = CCounterRNG::Generate(m_Config.m_WorldSeed, id, 0,
+                                                             ERandomStream::Initialization);
+
+            // Random sector
+            ESector sector = static_cast<ESector>(CCounterRNG::ToRange(draws[0], static_cast<uint32_t>(ESector::COUNT)));
+
+            // Random size (weighted toward smaller companies)
+            ECompanySize size = SizeFromRoll(static_cast<int32_t>(CCounterRNG::ToRange(draws[1], SIZE_ROLLS)));
+
+            // Create attributes based on sector
+            SCompanyAttributes attrs = MakeSectorAttributes(sector, size);
+
+            // Create company
+            m_Companies.AddCompany(id, attrs, 1.0f, static_cast<uint16_t>(leaf));
+        }
+    }
+}
+
+void CEconomyManager::InitializeSampledCompanies()
+{
+    // Stratum populations follow the same sector and size odds as the
+    // individual generator. Spread is taken proportional to the starting
+    // headcount (constant coefficient of variation), so Neyman allocation
+    // oversamples the larger firms that dominate employment and GDP.
+    int64_t represented = m_Config.m_Sampling.m_RepresentedCompanies;
+    int64_t assigned = 0;
+    int32_t lastStratum = -1;
+
+    for (int32_t sector = 0; sector < static_cast<int32_t>(ESector::COUNT); ++sector)
+    {
+        for (int32_t size = 0; size < CSamplingStrategy::SIZE_COUNT; ++size)
+        {
+            uint32_t rolls = 0;
+            for (uint32_t roll = 0; roll < SIZE_ROLLS; ++roll)
+            {
+                rolls += SizeFromRoll(static_cast<int32_t>(roll)) == static_cast<ECompanySize>(size) ? 1 : 0;
+            }
+
+            int64_t population = represented * rolls / (SIZE_ROLLS * static_cast<int64_t>(ESector::COUNT));
+            SCompanyAttributes attrs = MakeSectorAttributes(static_cast<ESector>(sector), static_cast<ECompanySize>(size));
+            float variability = static_cast<float>(CCompanyStore::MakeInitialState(attrs).m_Employees);
+
+            m_Sampling.SetPopulation(attrs.m_Sector, attrs.m_Size, population, variability);
+            assigned += population;
+            if (rolls > 0)
+            {
+                lastStratum = CSamplingStrategy::GetStratumIndex(attrs.m_Sector, attrs.m_Size);
+            }
+        }
+    }
+
+    // Rounding leftovers go to the last populated stratum
+    if (lastStratum >= 0 && assigned < represented)
+    {
+        const SStratumSample& last = m_Sampling.GetStratum(lastStratum);
+        m_Sampling.SetPopulation(CSamplingStrategy::GetStratumSector(lastStratum),
+                                 CSamplingStrategy::GetStratumSize(lastStratum),
+                                 last.m_Population + represented - assigned, last.m_Variability);
+    }
+
+    m_Sampling.Allocate(m_Config.m_CompanyCount, m_Config.m_Sampling.m_MinimumPerStratum);
+
+    // Each stratum's sample is split over the leaf regions by share, and
+    // its population in proportion to the sample
+    std::vector<std::vector<int64_t>> leafSamples(CSamplingStrategy::STRATUM_COUNT);
+    for (int32_t stratum = 0; stratum < CSamplingStrategy::STRATUM_COUNT; ++stratum)
+    {
+        leafSamples[stratum] = m_Regions.SplitByShare(m_Sampling.GetStratum(stratum).m_SampleSize);
+    }
+
+    // Create each stratum's sample, region by region. Weights are whole
+    // firms (the first population % sample companies stand for one more),
+    // so moving weight between tiers never splits a firm.
+    m_Companies.Reserve(static_cast<size_t>(m_Sampling.GetTotalSampleSize()));
+    std::vector<int64_t> samplesBefore(CSamplingStrategy::STRATUM_COUNT, 0);
+    for (int32_t leaf = 0; leaf < m_Regions.GetLeafCount(); ++leaf)
+    {
+        for (int32_t stratum = 0; stratum < CSamplingStrategy::STRATUM_COUNT; ++stratum)
+        {
+            const SStratumSample& sample = m_Sampling.GetStratum(stratum);
+            int64_t sampleSize = leafSamples[stratum][leaf];
+            if (sampleSize <= 0)
+            {
+                continue;
+            }
+
+            int64_t populationBefore = sample.m_Population * samplesBefore[stratum] / sample.m_SampleSize;
+            samplesBefore[stratum] += sampleSize;
+            int64_t population = sample.m_Population * samplesBefore[stratum] / sample.m_SampleSize - populationBefore;
+
+            SCompanyAttributes attrs = MakeSectorAttributes(CSamplingStrategy::GetStratumSector(stratum),
+                                                            CSamplingStrategy::GetStratumSize(stratum));
+            int64_t baseWeight = population / sampleSize;
+            int64_t heavierCount = population % sampleSize;
+
+            for (int64_t i = 0; i < sampleSize; ++i)
+            {
+                float weight = static_cast<float>(baseWeight + (i < heavierCount ? 1 : 0));
+                // The per-stratum minimum can push the sample past the last ID
+                uint32_t id = m_CompanyIDs.Allocate();
+                if (id == CCompanyIDAllocator::INVALID_ID)
+                {
+                    return;
+                }
+                m_Companies.AddCompany(id, attrs, weight, static_cast<uint16_t>(leaf));
+            }
+        }
+    }
+}
+
+void CEconomyManager::InitializeClusters()
+{
+    m_Clusters.clear();
+    m_Clusters.reserve(m_Config.m_Clusters.size());
+
+    for (size_t i = 0; i < m_Config.m_Clusters.size(); ++i)
+    {
+        const SClusterConfig& cluster = m_Config.m_Clusters[i];
+        int32_t leaf = cluster.m_Region;
+        if (leaf < 0 || leaf >= m_Regions.GetLeafCount())
+        {
+            std::cerr << "Cluster " << i << ": no leaf region " << leaf << ", using region 0" << std::endl;
+            leaf = 0;
         }
 
-        // Create company
-        std::string name = "Company_" + std::to_string(m_NextCompanyID);
-        m_Companies.push_back(std::make_unique<CCompany>(m_NextCompanyID, name, attrs));
-        m_NextCompanyID++;
+        m_Clusters.emplace_back(static_cast<uint32_t>(i), static_cast<uint16_t>(leaf), cluster,
+                                MakeSectorAttributes(cluster.m_Sector, cluster.m_Size));
+    }
+}
+
+void CEconomyManager::RebuildRegionTasks()
+{
+    // One task per PARALLEL_GRAIN_SIZE chunk of each leaf's rows
+    m_Regions.SetLeafRanges(m_Companies.GetRegions(), m_Companies.GetCount());
+
+    int32_t leafCount = m_Regions.GetLeafCount();
+    m_RegionTasks.clear();
+    m_LeafFirstTask.assign(static_cast<size_t>(leafCount) + 1, 0);
+
+    for (int32_t leaf = 0; leaf < leafCount; ++leaf)
+    {
+        size_t end = m_Regions.GetLeafEnd(leaf);
+        for (size_t begin = m_Regions.GetLeafBegin(leaf); begin < end; begin += PARALLEL_GRAIN_SIZE)
+        {
+            m_RegionTasks.push_back({ leaf, begin, std::min(begin + PARALLEL_GRAIN_SIZE, end) });
+        }
+        m_LeafFirstTask[leaf + 1] = m_RegionTasks.size();
+    }
+}
+
+void CEconomyManager::SimulateClusters(const SPolicyParams& policy, const SSimulationTick& tick)
+{
+    // A handful of clusters: cheaper to run inline than to hand out
+    float expectationSmoothing = m_Companies.GetExpectationSmoothing();
+
+    float referenceMargin = GetProfitMargin();
+
+    // Entry first weighs each cluster's margin and saturation, then each
+    // region's rates are scaled so its clusters replace their exits in total
+    std::vector<double> regionExits(static_cast<size_t>(m_Regions.GetLeafCount()), 0.0);
+    std::vector<double> regionEntries(regionExits.size(), 0.0);
+    std::vector<float> entryRates(m_Clusters.size(), 0.0f);
+
+    for (size_t i = 0; i < m_Clusters.size(); ++i)
+    {
+        CCompanyCluster& cluster = m_Clusters[i];
+        const SMacroState& macro = m_Regions.GetLeafMacroState(cluster.GetRegion());
+        SFinancialCoefficients coefficients = CCompanyKernels::BuildCoefficients(policy, macro);
+        cluster.Simulate(coefficients, policy, macro, expectationSmoothing);
+
+        double population = static_cast<double>(cluster.GetPopulation());
+        entryRates[i] = cluster.GetEntryRate(macro, referenceMargin);
+        regionExits[cluster.GetRegion()] += population * cluster.GetExitRate();
+        regionEntries[cluster.GetRegion()] += population * entryRates[i];
+    }
+
+    for (size_t i = 0; i < m_Clusters.size(); ++i)
+    {
+        CCompanyCluster& cluster = m_Clusters[i];
+        double entries = regionEntries[cluster.GetRegion()];
+        double scale = entries > 0.0 ? regionExits[cluster.GetRegion()] / entries : 1.0;
+        cluster.UpdatePopulation(static_cast<float>(entryRates[i] * scale), tick);
     }
 }
 
 void CEconomyManager::SimulateAllCompanies()
 {
-    // Simulate each company for one month
-    for (const auto& company : m_Companies)
+    // Simulate each company for one month. Companies only read the shared
+    // policy and their region's macro state and write their own slots, so
+    // region chunks run as independent tasks.
+    SSimulationTick tick(m_Config.m_WorldSeed, m_Tick);
+    m_WorkerPool->ParallelFor(m_RegionTasks.size(), 1,
+        [this, &tick](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const SRegionTask& task = m_RegionTasks[i];
+                m_Companies.SimulateRange(task.m_Begin, task.m_End, m_PolicyParams,
+                                          m_Regions.GetLeafMacroState(task.m_Leaf), tick);
+            }
+        });
+    m_Companies.AdvanceHistory();
+
+    SimulateClusters(m_PolicyParams, tick);
+}
+
+void CEconomyManager::UpdateFirmPopulation()
+{
+    if (!m_FirmDynamics.IsEnabled())
+    {
+        return;
+    }
+
+    // Closures are picked in parallel, one scan per region chunk; the
+    // changes are then made serially in chunk order
+    SSimulationTick tick(m_Config.m_WorldSeed, m_Tick);
+    m_FirmScans.resize(m_RegionTasks.size());
+    m_WorkerPool->ParallelFor(m_RegionTasks.size(), 1,
+        [this, &tick](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const SRegionTask& task = m_RegionTasks[i];
+                m_FirmDynamics.Scan(m_Companies, task.m_Begin, task.m_End, task.m_Leaf, tick, m_FirmScans[i]);
+            }
+        });
+
+    size_t rowCount = m_Companies.GetCount();
+    bool appended = m_FirmDynamics.Apply(m_Companies, m_CompanyIDs, m_Regions, m_FirmScans, tick, GetProfitMargin());
+
+    // Entrants beyond a region's closed rows were appended at the end.
+    // Closed rows are skipped by the tick but still split its batches and
+    // hold memory, so a wave of closures compacts early.
+    if (m_FirmDynamics.IsCompactionDue(m_Tick + 1) ||
+        m_FirmDynamics.GetLastEmptyRows() * 4 > m_Companies.GetCount())
+    {
+        m_Companies.Compact();
+    }
+    else if (appended)
+    {
+        m_Companies.SortByBucket();
+    }
+
+    if (m_Companies.GetCount() != rowCount || appended)
+    {
+        RebuildRegionTasks();
+    }
+}
+
+void CEconomyManager::ReviewLevelOfDetail()
+{
+    // Between simulation and aggregation, so the macro state of this month
+    // already sees the new tiers (totals are the same either way)
+    if (m_LOD.IsReviewDue(m_Tick + 1))
     {
-        if (company)
+        m_LOD.Review(m_Companies, m_Clusters, m_CompanyIDs);
+
+        // Transfers append and swap rows; regroup them into buckets (closed
+        // rows are dropped on the way)
+        m_Companies.Compact();
+        RebuildRegionTasks();
+    }
+}
+
+SCompanyAggregates CEconomyManager::AggregateCompanies()
+{
+    // One fused pass per region chunk, run in parallel
+    size_t taskCount = m_RegionTasks.size();
+    m_AggregatePartials.resize(taskCount);
+
+    m_WorkerPool->ParallelFor(taskCount, 1,
+        [this](size_t begin, size_t end)
         {
-            company->SimulateMonth(m_PolicyParams, m_MacroState);
+            for (size_t i = begin; i < end; ++i)
+            {
+                m_AggregatePartials[i] = m_Companies.Aggregate(m_RegionTasks[i].m_Begin, m_RegionTasks[i].m_End);
+            }
+        });
+
+    // Combine each leaf's partials pairwise in a fixed tree. Chunks do not
+    // depend on the thread count, so neither does the rounding of the sums.
+    for (int32_t leaf = 0; leaf < m_Regions.GetLeafCount(); ++leaf)
+    {
+        size_t first = m_LeafFirstTask[leaf];
+        size_t chunkCount = m_LeafFirstTask[leaf + 1] - first;
+        for (size_t stride = 1; stride < chunkCount; stride *= 2)
+        {
+            for (size_t i = 0; i + stride < chunkCount; i += stride * 2)
+            {
+                m_AggregatePartials[first + i].Merge(m_AggregatePartials[first + i + stride]);
+            }
         }
+
+        m_Regions.GetLeafAggregates(leaf) = chunkCount > 0 ? m_AggregatePartials[first] : SCompanyAggregates();
     }
+
+    // Clusters are added last, in a fixed order
+    for (const CCompanyCluster& cluster : m_Clusters)
+    {
+        cluster.Accumulate(m_Regions.GetLeafAggregates(cluster.GetRegion()));
+    }
+
+    // Leaves -> parent regions -> nation
+    return m_Regions.AggregateUp();
 }
 
 void CEconomyManager::UpdateMacroState()
 {
-    // Calculate aggregates from all companies
-    float totalEmployees = 0.0f;
-    float totalRevenue = 0.0f;
-    float totalProfit = 0.0f;
-    float totalWages = 0.0f;
+    UpdateMacroState(m_PolicyParams);
+}
 
-    size_t companyCount = m_Companies.size();
-    if (companyCount == 0)
+void CEconomyManager::UpdateMacroState(const SPolicyParams& policy)
+{
+    // Calculate aggregates from all companies and clusters, per region
+    SCompanyAggregates aggregates = AggregateCompanies();
+    m_RepresentedCompanies = aggregates.m_CompanyCount;
+    if (aggregates.m_CompanyCount <= 0.0)
     {
         return;
     }
 
-    for (const auto& company : m_Companies)
+    // Update aggregates
+    m_TotalEmployment = static_cast<float>(aggregates.m_TotalEmployees);
+    m_TotalGDP = static_cast<float>(aggregates.m_TotalRevenue);
+    m_AverageProfitability = static_cast<float>(aggregates.m_TotalProfit / aggregates.m_CompanyCount);
+
+    // National macro state, then every region's from its own totals
+    ComputeMacroState(aggregates, policy, m_MacroState);
+    for (int32_t region = 0; region < m_Regions.GetRegionCount(); ++region)
     {
-        if (company)
+        const SCompanyAggregates& regional = m_Regions.GetAggregates(region);
+        if (regional.m_CompanyCount > 0.0)
         {
-            totalEmployees += static_cast<float>(company->GetEmployees());
-            totalRevenue += company->GetMonthlyRevenue();
-            totalProfit += company->GetProfitability();
-            totalWages += company->GetWageLevel();
+            ComputeMacroState(regional, policy, m_Regions.GetMacroState(region));
         }
     }
+}
 
-    // Update aggregates
-    m_TotalEmployment = totalEmployees;
-    m_TotalGDP = totalRevenue;
-    m_AverageProfitability = totalProfit / static_cast<float>(companyCount);
+void CEconomyManager::ComputeMacroState(const SCompanyAggregates& aggregates, const SPolicyParams& policy,
+                                        SMacroState& macro) const
+{
+    double companyCount = aggregates.m_CompanyCount;
+    float totalEmployees = static_cast<float>(aggregates.m_TotalEmployees);
+    float averageProfitability = static_cast<float>(aggregates.m_TotalProfit / companyCount);
 
     // Update macro state
-    m_MacroState.m_AverageWage = totalWages / static_cast<float>(companyCount);
+    macro.m_AverageWage = static_cast<float>(aggregates.m_TotalWages / companyCount);
 
     // Unemployment rate (simplified: assume workforce = 2x employment)
     float workforce = totalEmployees * 2.0f;
-    m_MacroState.m_UnemploymentRate = ((workforce - totalEmployees) / workforce) * 100.0f;
+    macro.m_UnemploymentRate = ((workforce - totalEmployees) / workforce) * 100.0f;
 
     // Business confidence (based on profitability)
-    if (m_AverageProfitability > 10.0f)
+    if (averageProfitability > 10.0f)
     {
-        m_MacroState.m_BusinessConfidence = 70.0f;
+        macro.m_BusinessConfidence = 70.0f;
     }
-    else if (m_AverageProfitability > 0.0f)
+    else if (averageProfitability > 0.0f)
     {
-        m_MacroState.m_BusinessConfidence = 55.0f;
+        macro.m_BusinessConfidence = 55.0f;
     }
-    else if (m_AverageProfitability > -10.0f)
+    else if (averageProfitability > -10.0f)
     {
-        m_MacroState.m_BusinessConfidence = 40.0f;
+        macro.m_BusinessConfidence = 40.0f;
     }
     else
     {
-        m_MacroState.m_BusinessConfidence = 25.0f;
+        macro.m_BusinessConfidence = 25.0f;
     }
 
     // Aggregate demand (function of employment and confidence)
-    m_MacroState.m_AggregateDemand = (totalEmployees / workforce) *
-                                     (m_MacroState.m_BusinessConfidence / 50.0f);
-
-    // Calculate sector-specific metrics for market saturation
-    int32_t sectorCompanyCounts[static_cast<int32_t>(ESector::COUNT)] = {0};
-    float sectorRevenue[static_cast<int32_t>(ESector::COUNT)] = {0.0f};
-
-    for (const auto& company : m_Companies)
-    {
-        if (company)
-        {
-            ESector sector = company->GetAttributes().m_Sector;
-            int32_t sectorIndex = static_cast<int32_t>(sector);
-            sectorCompanyCounts[sectorIndex]++;
-            sectorRevenue[sectorIndex] += company->GetMonthlyRevenue();
-        }
-    }
+    macro.m_AggregateDemand = (totalEmployees / workforce) *
+                              (macro.m_BusinessConfidence / 50.0f);
 
     // Calculate saturation and import competition for each sector
     for (int32_t i = 0; i < static_cast<int32_t>(ESector::COUNT); ++i)
     {
         // Saturation based on company count (50 companies = 0.5, 100+ = 1.0)
-        float companySaturation = std::min(1.0f, static_cast<float>(sectorCompanyCounts[i]) / 100.0f);
+        float companySaturation = std::min(1.0f, static_cast<float>(aggregates.m_SectorCompanyCount[i]) / 100.0f);
 
         // Saturation also based on total revenue in sector (50M revenue = saturated)
-        float revenueSaturation = std::min(1.0f, sectorRevenue[i] / 50000.0f);
+        float revenueSaturation = std::min(1.0f, static_cast<float>(aggregates.m_SectorRevenue[i]) / 50000.0f);
 
         // Combined saturation (average of both factors)
-        m_MacroState.m_SectorSaturation[i] = (companySaturation + revenueSaturation) / 2.0f;
+        macro.m_SectorSaturation[i] = (companySaturation + revenueSaturation) / 2.0f;
 
         // Policy-dependent import competition
         // Base competition varies by sector (structural factors)
@@ -243,8 +1005,8 @@ void CEconomyManager::UpdateMacroState()
 
         // Tariffs reduce import competition (protectionism)
         // At 50% tariff, import competition is reduced by 50%
-        float tariffProtection = m_PolicyParams.m_TariffRate / 100.0f;
-        m_MacroState.m_ImportCompetition[i] = baseImportCompetition * (1.0f - tariffProtection);
+        float tariffProtection = policy.m_TariffRate / 100.0f;
+        macro.m_ImportCompetition[i] = baseImportCompetition * (1.0f - tariffProtection);
     }
 }
 
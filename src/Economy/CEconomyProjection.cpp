@@ -0,0 +1,105 @@
+#include "Economy/CEconomyProjection.h"
+#include <algorithm>
+
+namespace PoliticSim {
+
+CEconomyProjection::CEconomyProjection()
+    : m_Fork()
+    , m_Thread()
+    , m_Cancel(false)
+    , m_Finished(false)
+    , m_OnFinished()
+    , m_Series()
+    , m_Generation(0)
+{
+}
+
+CEconomyProjection::~CEconomyProjection()
+{
+    Cancel();
+}
+
+void CEconomyProjection::Start(const CEconomyManager& economy, const SPolicyParams& policy, int32_t months,
+                               std::function<void()> onFinished)
+{
+    Cancel();
+
+    m_Fork = economy.Fork();
+    m_Fork->SetPolicyParams(policy);
+
+    size_t count = static_cast<size_t>(std::max(months, 0));
+    m_Series.m_StartTick = economy.GetTick();
+    m_Series.m_Generation = ++m_Generation;
+    m_Series.m_Policy = policy;
+    m_Series.m_GDP.clear();
+    m_Series.m_GDP.reserve(count);
+    m_Series.m_Employment.clear();
+    m_Series.m_Employment.reserve(count);
+    m_Series.m_UnemploymentRate.clear();
+    m_Series.m_UnemploymentRate.reserve(count);
+    m_Series.m_AverageProfitability.clear();
+    m_Series.m_AverageProfitability.reserve(count);
+    m_Series.m_BusinessConfidence.clear();
+    m_Series.m_BusinessConfidence.reserve(count);
+
+    m_OnFinished = std::move(onFinished);
+    m_Cancel.store(false, std::memory_order_relaxed);
+    m_Finished.store(false, std::memory_order_relaxed);
+    m_Thread = std::thread(&CEconomyProjection::Run, this, months);
+}
+
+void CEconomyProjection::Cancel()
+{
+    if (m_Thread.joinable())
+    {
+        m_Cancel.store(true, std::memory_order_relaxed);
+        m_Thread.join();
+    }
+    m_Finished.store(false, std::memory_order_relaxed);
+    m_Fork.reset();
+}
+
+bool CEconomyProjection::TakeResult(SProjectionSeries& series)
+{
+    if (!m_Thread.joinable() || !m_Finished.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    m_Thread.join();
+    m_Finished.store(false, std::memory_order_relaxed);
+    m_Fork.reset();
+    series = m_Series;
+    return true;
+}
+
+void CEconomyProjection::AppendMonth(const CEconomyManager& economy, SProjectionSeries& series)
+{
+    series.m_GDP.push_back(economy.GetTotalGDP());
+    series.m_Employment.push_back(economy.GetTotalEmployment());
+    series.m_UnemploymentRate.push_back(economy.GetUnemploymentRate());
+    series.m_AverageProfitability.push_back(economy.GetAverageProfitability());
+    series.m_BusinessConfidence.push_back(economy.GetMacroState().m_BusinessConfidence);
+}
+
+void CEconomyProjection::Run(int32_t months)
+{
+    for (int32_t month = 0; month < months; ++month)
+    {
+        if (m_Cancel.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_Fork->AdvanceMonth();
+        AppendMonth(*m_Fork, m_Series);
+    }
+
+    m_Finished.store(true, std::memory_order_release);
+    if (m_OnFinished)
+    {
+        m_OnFinished();
+    }
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,278 @@
+#include "Economy/CFirmDynamics.h"
+#include "Economy/CEconomyManager.h"
+#include "Random/CCounterRNG.h"
+#include <algorithm>
+#include <cmath>
+
+namespace PoliticSim {
+
+CFirmDynamics::CFirmDynamics()
+    : m_Config()
+    , m_LastEntries(0)
+    , m_LastExits(0)
+    , m_LastEmptyRows(0)
+{
+}
+
+float CFirmDynamics::GetMonthlyTurnover(ECompanySize size)
+{
+    switch (size)
+    {
+        case ECompanySize::Micro: return 0.20f / 12.0f;
+        case ECompanySize::Small: return 0.15f / 12.0f;
+        case ECompanySize::Medium: return 0.05f / 12.0f;
+        case ECompanySize::Large: return 0.005f / 12.0f;
+    }
+    return 0.0f;
+}
+
+float CFirmDynamics::GetEntryRate(float exitRate, float margin, float referenceMargin,
+                                  float saturation, float referenceSaturation)
+{
+    // A margin 25 points above the economy's doubles entry's pull
+    float profitFactor = 1.0f + std::clamp((margin - referenceMargin) * 2.0f, -0.5f, 0.5f);
+    float saturationFactor = 1.0f - std::clamp(saturation - referenceSaturation, -0.5f, 0.5f);
+    return exitRate * profitFactor * saturationFactor;
+}
+
+float CFirmDynamics::GetProfitMargin(double profit, double revenue)
+{
+    return revenue > 0.0 ? static_cast<float>(profit / revenue) : 0.0f;
+}
+
+float CFirmDynamics::GetMeanSaturation(const SMacroState& macro)
+{
+    float total = 0.0f;
+    for (int32_t sector = 0; sector < static_cast<int32_t>(ESector::COUNT); ++sector)
+    {
+        total += macro.m_SectorSaturation[sector];
+    }
+    return total / static_cast<float>(ESector::COUNT);
+}
+
+void CFirmDynamics::Configure(const SFirmDynamicsConfig& config)
+{
+    m_Config = config;
+    m_LastEntries = 0;
+    m_LastExits = 0;
+    m_LastEmptyRows = 0;
+}
+
+bool CFirmDynamics::IsCompactionDue(uint32_t month) const
+{
+    return m_Config.m_CompactionInterval > 0 && month > 0 &&
+           month % static_cast<uint32_t>(m_Config.m_CompactionInterval) == 0;
+}
+
+void CFirmDynamics::Scan(const CCompanyStore& companies, size_t begin, size_t end, int32_t leaf,
+                         const SSimulationTick& tick, SFirmScan& scan) const
+{
+    scan.m_Leaf = leaf;
+    std::fill(std::begin(scan.m_Strata), std::end(scan.m_Strata), SFirmStratumTotals());
+    scan.m_Closing.clear();
+    scan.m_Empty.clear();
+
+    const uint32_t* ids = companies.GetIDs();
+    const float* weights = companies.GetWeights();
+    const float* liquidity = companies.GetLiquidity();
+    const float* profitability = companies.GetProfitability();
+    const float* revenue = companies.GetLastRevenue();
+    const ESector* sectors = companies.GetSectors();
+    const ECompanySize* sizes = companies.GetSizes();
+
+    // Closure rolls are keyed by company ID, like the reinvestment rolls
+    uint32_t exitRolls[CCompanyStore::SIMULATION_BLOCK_SIZE];
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += CCompanyStore::SIMULATION_BLOCK_SIZE)
+    {
+        size_t blockEnd = std::min(end, blockBegin + CCompanyStore::SIMULATION_BLOCK_SIZE);
+        CCounterRNG::Next32Batch(tick.m_WorldSeed, &ids[blockBegin], blockEnd - blockBegin, tick.m_Tick,
+                                 ERandomStream::FirmExit, exitRolls);
+
+        for (size_t i = blockBegin; i < blockEnd; ++i)
+        {
+            if (companies.IsClosed(i))
+            {
+                scan.m_Empty.push_back(i);
+                continue;
+            }
+
+            // Bankrupt firms always close, others at the normal turnover rate
+            SFirmStratumTotals& totals = scan.m_Strata[CSamplingStrategy::GetStratumIndex(sectors[i], sizes[i])];
+            bool bankrupt = liquidity[i] < CCompanyStore::BANKRUPTCY_LIQUIDITY;
+            if (bankrupt || CCounterRNG::ToUnitFloat(exitRolls[i - blockBegin]) < GetMonthlyTurnover(sizes[i]))
+            {
+                scan.m_Closing.push_back(i);
+                totals.m_ExitRows++;
+                totals.m_ExitWeight += weights[i];
+                continue;
+            }
+
+            totals.m_Rows++;
+            totals.m_Weight += weights[i];
+            totals.m_Profit += static_cast<double>(weights[i]) * profitability[i];
+            totals.m_Revenue += static_cast<double>(weights[i]) * revenue[i];
+        }
+    }
+}
+
+bool CFirmDynamics::Apply(CCompanyStore& companies, CCompanyIDAllocator& ids, const CRegionMap& regions,
+                          const std::vector<SFirmScan>& scans, const SSimulationTick& tick, float referenceMargin)
+{
+    constexpr int32_t STRATUM_COUNT = CSamplingStrategy::STRATUM_COUNT;
+    int32_t leafCount = regions.GetLeafCount();
+
+    m_LastEntries = 0;
+    m_LastExits = 0;
+    m_LastEmptyRows = 0;
+    m_Strata.assign(static_cast<size_t>(leafCount) * STRATUM_COUNT, SFirmStratumTotals());
+    m_FreeRows.clear();
+    m_LeafFreeRows.assign(static_cast<size_t>(leafCount) + 1, 0);
+
+    // 1. Close this month's exits; their rows join the region's free rows
+    size_t scanIndex = 0;
+    for (int32_t leaf = 0; leaf < leafCount; ++leaf)
+    {
+        for (; scanIndex < scans.size() && scans[scanIndex].m_Leaf == leaf; ++scanIndex)
+        {
+            const SFirmScan& scan = scans[scanIndex];
+            for (int32_t stratum = 0; stratum < STRATUM_COUNT; ++stratum)
+            {
+                SFirmStratumTotals& totals = m_Strata[static_cast<size_t>(leaf) * STRATUM_COUNT + stratum];
+                totals.m_Rows += scan.m_Strata[stratum].m_Rows;
+                totals.m_Weight += scan.m_Strata[stratum].m_Weight;
+                totals.m_Profit += scan.m_Strata[stratum].m_Profit;
+                totals.m_Revenue += scan.m_Strata[stratum].m_Revenue;
+                totals.m_ExitRows += scan.m_Strata[stratum].m_ExitRows;
+                totals.m_ExitWeight += scan.m_Strata[stratum].m_ExitWeight;
+            }
+
+            for (size_t row : scan.m_Closing)
+            {
+                m_LastExits += std::llround(companies.GetWeights()[row]);
+                ids.Release(companies.GetIDs()[row]);
+                companies.CloseCompany(row);
+            }
+            m_FreeRows.insert(m_FreeRows.end(), scan.m_Empty.begin(), scan.m_Empty.end());
+            m_FreeRows.insert(m_FreeRows.end(), scan.m_Closing.begin(), scan.m_Closing.end());
+        }
+        m_LeafFreeRows[leaf + 1] = m_FreeRows.size();
+    }
+
+    // 2. Entrants of each stratum that had firms at the start of the month:
+    // its exits (turnover and bankruptcies) replaced, scaled by the
+    // stratum's margin and saturation. The expected count is rounded up or
+    // down at random, so small strata still see entry. Each entrant stands
+    // for as many firms as the stratum's average row.
+    // Entrants take free rows of their own sector x size first, so the
+    // rows stay in buckets (see CCompanyStore::SortByBucket).
+    bool appended = false;
+    for (int32_t leaf = 0; leaf < leafCount; ++leaf)
+    {
+        const SMacroState& macro = regions.GetLeafMacroState(leaf);
+        float referenceSaturation = GetMeanSaturation(macro);
+        auto leafBegin = m_FreeRows.begin() + static_cast<std::ptrdiff_t>(m_LeafFreeRows[leaf]);
+        auto leafEnd = m_FreeRows.begin() + static_cast<std::ptrdiff_t>(m_LeafFreeRows[leaf + 1]);
+        std::stable_sort(leafBegin, leafEnd,
+            [&companies](size_t a, size_t b) { return companies.GetBucket(a) < companies.GetBucket(b); });
+
+        size_t nextFree[STRATUM_COUNT];
+        size_t freeEnd[STRATUM_COUNT];
+        std::fill(std::begin(nextFree), std::end(nextFree), m_LeafFreeRows[leaf]);
+        std::fill(std::begin(freeEnd), std::end(freeEnd), m_LeafFreeRows[leaf]);
+        for (size_t free = m_LeafFreeRows[leaf]; free < m_LeafFreeRows[leaf + 1]; ++free)
+        {
+            size_t stratum = companies.GetBucket(m_FreeRows[free]) % STRATUM_COUNT;
+            if (freeEnd[stratum] == nextFree[stratum])
+            {
+                nextFree[stratum] = free;
+            }
+            freeEnd[stratum] = free + 1;
+        }
+
+        // Expected entrant rows and their weight. The rates are scaled so
+        // the region's entrants stand for as many firms as just left: margin
+        // and saturation shift entry between strata without shrinking or
+        // growing the region.
+        double expectedRows[STRATUM_COUNT] = {};
+        double rowWeights[STRATUM_COUNT] = {};
+        double exitFirms = 0.0;
+        double entryFirms = 0.0;
+        for (int32_t stratum = 0; stratum < STRATUM_COUNT; ++stratum)
+        {
+            const SFirmStratumTotals& totals = m_Strata[static_cast<size_t>(leaf) * STRATUM_COUNT + stratum];
+            int64_t startRows = totals.m_Rows + totals.m_ExitRows;
+            if (startRows == 0)
+            {
+                continue;
+            }
+
+            ESector sector = CSamplingStrategy::GetStratumSector(stratum);
+            float exitRate = static_cast<float>(totals.m_ExitRows) / static_cast<float>(startRows);
+
+            // A stratum that closed entirely counts as neutral
+            float margin = totals.m_Rows > 0 ? GetProfitMargin(totals.m_Profit, totals.m_Revenue) : referenceMargin;
+            float rate = GetEntryRate(exitRate, margin, referenceMargin,
+                                      macro.m_SectorSaturation[static_cast<int32_t>(sector)], referenceSaturation);
+
+            double rowWeight = totals.m_Rows > 0 ? totals.m_Weight / static_cast<double>(totals.m_Rows)
+                                                 : totals.m_ExitWeight / static_cast<double>(totals.m_ExitRows);
+            rowWeights[stratum] = static_cast<double>(std::max<int64_t>(1, std::llround(rowWeight)));
+            expectedRows[stratum] = static_cast<double>(startRows) * rate;
+            exitFirms += totals.m_ExitWeight;
+            entryFirms += expectedRows[stratum] * rowWeights[stratum];
+        }
+        double scale = entryFirms > 0.0 ? exitFirms / entryFirms : 1.0;
+
+        for (int32_t stratum = 0; stratum < STRATUM_COUNT; ++stratum)
+        {
+            if (expectedRows[stratum] <= 0.0)
+            {
+                continue;
+            }
+
+            uint32_t key = static_cast<uint32_t>(leaf) * STRATUM_COUNT + static_cast<uint32_t>(stratum);
+            ESector sector = CSamplingStrategy::GetStratumSector(stratum);
+            ECompanySize size = CSamplingStrategy::GetStratumSize(stratum);
+            float roll = CCounterRNG::ToUnitFloat(CCounterRNG::Next32(tick.m_WorldSeed, key, tick.m_Tick,
+                                                                      ERandomStream::FirmEntry));
+            int64_t entrants = static_cast<int64_t>(std::floor(expectedRows[stratum] * scale + roll));
+            float weight = static_cast<float>(rowWeights[stratum]);
+            SCompanyAttributes attributes = CEconomyManager::MakeSectorAttributes(sector, size);
+
+            for (int64_t i = 0; i < entrants; ++i)
+            {
+                uint32_t id = ids.Allocate();
+                if (id == CCompanyIDAllocator::INVALID_ID)
+                {
+                    break;
+                }
+
+                // Own bucket first, then any free row of the region
+                int32_t source = stratum;
+                for (int32_t other = 0; other < STRATUM_COUNT && nextFree[source] == freeEnd[source]; ++other)
+                {
+                    source = other;
+                }
+
+                if (nextFree[source] < freeEnd[source])
+                {
+                    companies.ReplaceCompany(m_FreeRows[nextFree[source]++], id, attributes, weight, static_cast<uint16_t>(leaf));
+                }
+                else
+                {
+                    companies.AddCompany(id, attributes, weight, static_cast<uint16_t>(leaf));
+                    appended = true;
+                }
+                m_LastEntries += static_cast<int64_t>(weight);
+            }
+        }
+        for (int32_t stratum = 0; stratum < STRATUM_COUNT; ++stratum)
+        {
+            m_LastEmptyRows += freeEnd[stratum] - nextFree[stratum];
+        }
+    }
+
+    return appended;
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,473 @@
+#include "Economy/CHistoryStore.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <algorithm>
+#include <cstring>
+
+namespace PoliticSim {
+
+namespace {
+
+constexpr float HALF_MAX = 65504.0f;
+
+// IEEE 754 binary32 -> binary16, round to nearest even. Callers clamp to
+// +-HALF_MAX first so history never stores infinities.
+uint16_t FloatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t exponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    // NaN stays NaN
+    if (exponent == 0xFFu)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+
+    int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+    if (halfExponent >= 31)
+    {
+        return static_cast<uint16_t>(sign | 0x7BFFu);
+    }
+
+    if (halfExponent <= 0)
+    {
+        // Subnormal half (or zero)
+        if (halfExponent < -10)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+
+        mantissa |= 0x800000u;
+        uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u)))
+        {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+    {
+        half++;  // A carry into the exponent is still the correct rounding
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float HalfToFloat(uint16_t half)
+{
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1Fu;
+    uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+
+    if (exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            bits = sign;
+        }
+        else
+        {
+            // Normalize the subnormal
+            exponent = 127 - 14;
+            while ((mantissa & 0x400u) == 0)
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            mantissa &= 0x3FFu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    }
+    else if (exponent == 31)
+    {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+CHistoryStore::CHistoryStore()
+    : m_Config()
+    , m_Count(0)
+    , m_Stride(0)
+    , m_WriteIndex(0)
+{
+}
+
+void CHistoryStore::Configure(const SHistoryConfig& config)
+{
+    size_t count = m_Count;
+    Clear();
+
+    m_Config = config;
+    m_Config.m_Depth = std::max(m_Config.m_Depth, 1);
+    m_Config.m_MetricMask &= SHistoryConfig::ALL_METRICS;
+
+    Resize(count);
+}
+
+void CHistoryStore::Reserve(size_t companyCount)
+{
+    if (companyCount > m_Stride)
+    {
+        Regrow(companyCount);
+    }
+}
+
+void CHistoryStore::Resize(size_t companyCount)
+{
+    // Grow geometrically so adding companies one at a time stays cheap
+    if (companyCount > m_Stride)
+    {
+        Regrow(std::max(companyCount, m_Stride * 2));
+    }
+    m_Count = companyCount;
+}
+
+void CHistoryStore::Clear()
+{
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        m_Float32[metric].clear();
+        m_Float32[metric].shrink_to_fit();
+        m_Float16[metric].clear();
+        m_Float16[metric].shrink_to_fit();
+    }
+    m_Count = 0;
+    m_Stride = 0;
+    m_WriteIndex = 0;
+}
+
+void CHistoryStore::Regrow(size_t stride)
+{
+    // Re-stride every month column; slots of companies not yet added stay zero
+    size_t depth = static_cast<size_t>(m_Config.m_Depth);
+
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        if (m_Config.m_Precision == EHistoryPrecision::Float32)
+        {
+            std::vector<float> column(depth * stride, 0.0f);
+            for (size_t month = 0; month < depth && m_Stride > 0; ++month)
+            {
+                std::copy_n(&m_Float32[metric][month * m_Stride], m_Count, &column[month * stride]);
+            }
+            m_Float32[metric].swap(column);
+        }
+        else
+        {
+            std::vector<uint16_t> column(depth * stride, 0);
+            for (size_t month = 0; month < depth && m_Stride > 0; ++month)
+            {
+                std::copy_n(&m_Float16[metric][month * m_Stride], m_Count, &column[month * stride]);
+            }
+            m_Float16[metric].swap(column);
+        }
+    }
+
+    m_Stride = stride;
+}
+
+void CHistoryStore::Record(EHistoryMetric metric, size_t begin, size_t end, const float* values)
+{
+    if (!IsRecorded(metric) || begin >= end)
+    {
+        return;
+    }
+
+    int32_t metricIndex = static_cast<int32_t>(metric);
+    size_t slot = GetSlot(begin, m_WriteIndex);
+
+    if (m_Config.m_Precision == EHistoryPrecision::Float32)
+    {
+        std::copy(values, values + (end - begin), &m_Float32[metricIndex][slot]);
+    }
+    else
+    {
+        uint16_t* column = &m_Float16[metricIndex][slot];
+        for (size_t i = 0; i < end - begin; ++i)
+        {
+            column[i] = FloatToHalf(std::clamp(values[i], -HALF_MAX, HALF_MAX));
+        }
+    }
+}
+
+void CHistoryStore::Record(EHistoryMetric metric, size_t begin, size_t end, const int32_t* values)
+{
+    if (!IsRecorded(metric) || begin >= end)
+    {
+        return;
+    }
+
+    int32_t metricIndex = static_cast<int32_t>(metric);
+    size_t slot = GetSlot(begin, m_WriteIndex);
+
+    if (m_Config.m_Precision == EHistoryPrecision::Float32)
+    {
+        float* column = &m_Float32[metricIndex][slot];
+        for (size_t i = 0; i < end - begin; ++i)
+        {
+            column[i] = static_cast<float>(values[i]);
+        }
+    }
+    else
+    {
+        uint16_t* column = &m_Float16[metricIndex][slot];
+        for (size_t i = 0; i < end - begin; ++i)
+        {
+            column[i] = FloatToHalf(std::clamp(static_cast<float>(values[i]), -HALF_MAX, HALF_MAX));
+        }
+    }
+}
+
+void CHistoryStore::Advance()
+{
+    m_WriteIndex = (m_WriteIndex + 1) % m_Config.m_Depth;
+}
+
+void CHistoryStore::CopyCompany(size_t from, size_t to)
+{
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        for (int32_t month = 0; month < m_Config.m_Depth; ++month)
+        {
+            if (m_Config.m_Precision == EHistoryPrecision::Float32)
+            {
+                m_Float32[metric][GetSlot(to, month)] = m_Float32[metric][GetSlot(from, month)];
+            }
+            else
+            {
+                m_Float16[metric][GetSlot(to, month)] = m_Float16[metric][GetSlot(from, month)];
+            }
+        }
+    }
+}
+
+void CHistoryStore::ClearCompany(size_t company)
+{
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        for (int32_t month = 0; month < m_Config.m_Depth; ++month)
+        {
+            if (m_Config.m_Precision == EHistoryPrecision::Float32)
+            {
+                m_Float32[metric][GetSlot(company, month)] = 0.0f;
+            }
+            else
+            {
+                m_Float16[metric][GetSlot(company, month)] = 0;
+            }
+        }
+    }
+}
+
+void CHistoryStore::Reorder(const std::vector<size_t>& order)
+{
+    // Rows left out of the order are dropped
+    size_t count = order.size();
+    if (m_Count == 0 || count == 0)
+    {
+        m_Count = count;
+        return;
+    }
+
+    std::vector<float> float32(count);
+    std::vector<uint16_t> float16(count);
+
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        for (int32_t month = 0; month < m_Config.m_Depth; ++month)
+        {
+            if (m_Config.m_Precision == EHistoryPrecision::Float32)
+            {
+                float* column = &m_Float32[metric][GetSlot(0, month)];
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float32[i] = column[order[i]];
+                }
+                std::copy(float32.begin(), float32.end(), column);
+            }
+            else
+            {
+                uint16_t* column = &m_Float16[metric][GetSlot(0, month)];
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float16[i] = column[order[i]];
+                }
+                std::copy(float16.begin(), float16.end(), column);
+            }
+        }
+    }
+    m_Count = count;
+}
+
+size_t CHistoryStore::GetMemoryBytes() const
+{
+    size_t bytes = 0;
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        bytes += m_Float32[metric].capacity() * sizeof(float);
+        bytes += m_Float16[metric].capacity() * sizeof(uint16_t);
+    }
+    return bytes;
+}
+
+void CHistoryStore::Save(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("HIST"));
+    writer.Write(m_Config.m_Depth);
+    writer.Write(m_Config.m_MetricMask);
+    writer.Write(m_Config.m_Precision);
+    writer.Write(static_cast<uint64_t>(m_Count));
+    writer.Write(m_WriteIndex);
+    writer.EndChunk();
+
+    // One chunk per kept metric: every month column, m_Count values each
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        writer.BeginChunk(SSaveFormat::MakeTag("HMET"));
+        for (int32_t month = 0; month < m_Config.m_Depth && m_Count > 0; ++month)
+        {
+            if (m_Config.m_Precision == EHistoryPrecision::Float32)
+            {
+                writer.WriteArray(&m_Float32[metric][GetSlot(0, month)], m_Count);
+            }
+            else
+            {
+                writer.WriteArray(&m_Float16[metric][GetSlot(0, month)], m_Count);
+            }
+        }
+        writer.EndChunk();
+    }
+}
+
+bool CHistoryStore::Load(CSaveReader& reader)
+{
+    Clear();
+
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("HIST")))
+    {
+        return false;
+    }
+    SHistoryConfig config;
+    reader.Read(config.m_Depth);
+    reader.Read(config.m_MetricMask);
+    reader.Read(config.m_Precision);
+    size_t count = static_cast<size_t>(reader.Read<uint64_t>());
+    int32_t writeIndex = reader.Read<int32_t>();
+    reader.EndChunk();
+
+    if (reader.IsGood() && (config.m_Depth < 1 || writeIndex < 0 || writeIndex >= config.m_Depth ||
+        (config.m_Precision != EHistoryPrecision::Float32 && config.m_Precision != EHistoryPrecision::Float16)))
+    {
+        reader.Fail("bad history layout");
+    }
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+
+    // Saved with the stride packed to the count, so each column is one copy
+    m_Config = config;
+    m_Config.m_MetricMask &= SHistoryConfig::ALL_METRICS;
+    m_Count = count;
+    m_Stride = count;
+    m_WriteIndex = writeIndex;
+
+    size_t values = static_cast<size_t>(m_Config.m_Depth) * count;
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        if (!IsRecorded(static_cast<EHistoryMetric>(metric)))
+        {
+            continue;
+        }
+
+        if (m_Config.m_Precision == EHistoryPrecision::Float32)
+        {
+            reader.ReadColumn(SSaveFormat::MakeTag("HMET"), values, m_Float32[metric]);
+        }
+        else
+        {
+            reader.ReadColumn(SSaveFormat::MakeTag("HMET"), values, m_Float16[metric]);
+        }
+    }
+
+    if (!reader.IsGood())
+    {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+float CHistoryStore::GetValue(EHistoryMetric metric, size_t company, int32_t month) const
+{
+    if (!IsRecorded(metric))
+    {
+        return 0.0f;
+    }
+
+    int32_t metricIndex = static_cast<int32_t>(metric);
+    size_t slot = GetSlot(company, month);
+
+    if (m_Config.m_Precision == EHistoryPrecision::Float32)
+    {
+        return m_Float32[metricIndex][slot];
+    }
+    return HalfToFloat(m_Float16[metricIndex][slot]);
+}
+
+void CHistoryStore::CopySeries(EHistoryMetric metric, size_t company, float* out) const
+{
+    // The slot about to be written next is the oldest sample
+    int32_t depth = m_Config.m_Depth;
+    for (int32_t i = 0; i < depth; ++i)
+    {
+        out[i] = GetValue(metric, company, (m_WriteIndex + i) % depth);
+    }
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,343 @@
+#include "Economy/CLODManager.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include "Economy/CSamplingStrategy.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace PoliticSim {
+
+namespace {
+
+// Cap on the growth term, so a firm with near-zero smoothed profit does
+// not outrank every large employer
+constexpr float MAX_GROWTH_SIGNAL = 2.0f;
+
+// Planned move of one row out of the store
+struct SDemotion
+{
+    size_t m_Row;
+    int32_t m_Cluster;      // Target cluster, or -1 to merge into m_Into
+    size_t m_Into;
+};
+
+// Demotions never cross regions: sinks are per (leaf region, stratum)
+size_t GetSinkKey(uint16_t region, ESector sector, ECompanySize size)
+{
+    return static_cast<size_t>(region) * CSamplingStrategy::STRATUM_COUNT +
+           static_cast<size_t>(CSamplingStrategy::GetStratumIndex(sector, size));
+}
+
+size_t GetRowSinkKey(const CCompanyStore& companies, size_t index)
+{
+    return GetSinkKey(companies.GetRegions()[index], companies.GetSectors()[index], companies.GetSizes()[index]);
+}
+
+} // namespace
+
+CLODManager::CLODManager()
+    : m_Config()
+    , m_RowBudget(0)
+    , m_LastPromotions(0)
+    , m_LastDemotions(0)
+    , m_FullAgentCount(0)
+{
+}
+
+void CLODManager::Configure(const SLODConfig& config, size_t rowBudget)
+{
+    m_Config = config;
+    m_Config.m_FullAgentBudget = std::max(m_Config.m_FullAgentBudget, 0);
+    m_Config.m_PromoteThreshold = std::max(m_Config.m_PromoteThreshold, m_Config.m_DemoteThreshold);
+    m_RowBudget = rowBudget;
+
+    m_LastPromotions = 0;
+    m_LastDemotions = 0;
+    m_FullAgentCount = 0;
+}
+
+void CLODManager::Save(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("LODM"));
+    writer.Write(m_Config);
+    writer.Write(static_cast<uint64_t>(m_RowBudget));
+    writer.Write(m_LastPromotions);
+    writer.Write(m_LastDemotions);
+    writer.Write(m_FullAgentCount);
+    writer.EndChunk();
+}
+
+bool CLODManager::Load(CSaveReader& reader)
+{
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("LODM")))
+    {
+        return false;
+    }
+    SLODConfig config = reader.Read<SLODConfig>();
+    size_t rowBudget = static_cast<size_t>(reader.Read<uint64_t>());
+    int32_t promotions = reader.Read<int32_t>();
+    int32_t demotions = reader.Read<int32_t>();
+    int32_t fullAgents = reader.Read<int32_t>();
+    reader.EndChunk();
+
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+
+    Configure(config, rowBudget);
+    m_LastPromotions = promotions;
+    m_LastDemotions = demotions;
+    m_FullAgentCount = fullAgents;
+    return true;
+}
+
+bool CLODManager::IsReviewDue(uint32_t month) const
+{
+    return IsEnabled() && month > 0 && month % static_cast<uint32_t>(m_Config.m_ReviewInterval) == 0;
+}
+
+float CLODManager::ScoreCompany(const CCompanyStore& companies, size_t index) const
+{
+    // Bankrupt firms have stopped operating and are never worth a full agent
+    int32_t employees = companies.GetEmployees()[index];
+    if (employees <= 0)
+    {
+        return 0.0f;
+    }
+
+    float profitability = companies.GetProfitability()[index];
+    float averageProfit = companies.GetAverageProfit()[index];
+
+    // Same trend as the expectation rule
+    float trend = (profitability - averageProfit) / (std::abs(averageProfit) + 0.1f);
+
+    float score = m_Config.m_EmployeeWeight * std::log10(1.0f + static_cast<float>(employees));
+    if (companies.GetStates()[index] == ECompanyState::Crisis)
+    {
+        score += m_Config.m_CrisisWeight;
+    }
+    score += m_Config.m_GrowthWeight * std::min(std::abs(trend), MAX_GROWTH_SIGNAL);
+    return score;
+}
+
+void CLODManager::Review(CCompanyStore& companies, std::vector<CCompanyCluster>& clusters, CCompanyIDAllocator& ids)
+{
+    m_LastPromotions = 0;
+    m_LastDemotions = 0;
+
+    size_t count = companies.GetCount();
+    m_Scores.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_Scores[i] = ScoreCompany(companies, i);
+    }
+
+    // Where each stratum's demoted firms go: its first cluster, else its
+    // heaviest sampled row
+    uint16_t lastRegion = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        lastRegion = std::max(lastRegion, companies.GetRegions()[i]);
+    }
+    for (const CCompanyCluster& cluster : clusters)
+    {
+        lastRegion = std::max(lastRegion, cluster.GetRegion());
+    }
+
+    size_t sinkCount = (static_cast<size_t>(lastRegion) + 1) * CSamplingStrategy::STRATUM_COUNT;
+    std::vector<int32_t>& clusterSink = m_ClusterSinks;
+    std::vector<int64_t>& rowSink = m_RowSinks;
+    clusterSink.assign(sinkCount, -1);
+    rowSink.assign(sinkCount, -1);
+
+    for (size_t c = 0; c < clusters.size(); ++c)
+    {
+        size_t key = GetSinkKey(clusters[c].GetRegion(), clusters[c].GetSector(), clusters[c].GetSize());
+        if (clusterSink[key] < 0)
+        {
+            clusterSink[key] = static_cast<int32_t>(c);
+        }
+    }
+
+    const float* weights = companies.GetWeights();
+    int32_t fullAgents = 0;
+    m_Candidates.clear();
+    m_Promotable.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (weights[i] == 1.0f)
+        {
+            fullAgents++;
+            m_Candidates.push_back(i);
+        }
+        else if (weights[i] > 1.0f)
+        {
+            size_t key = GetRowSinkKey(companies, i);
+            if (rowSink[key] < 0 || weights[i] > weights[rowSink[key]])
+            {
+                rowSink[key] = static_cast<int64_t>(i);
+            }
+        }
+    }
+
+    // Sampled rows with a matching cluster fold into it when unimportant
+    std::vector<SDemotion> demotions;
+    m_Planned.assign(count, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t key = GetRowSinkKey(companies, i);
+        if (weights[i] > 1.0f && clusterSink[key] >= 0 && m_Scores[i] < m_Config.m_DemoteThreshold)
+        {
+            demotions.push_back({ i, clusterSink[key], 0 });
+            m_Planned[i] = 1;
+        }
+    }
+
+    // Sampled rows that can give a full agent, most important first
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (weights[i] >= 2.0f && m_Planned[i] == 0 && m_Scores[i] > 0.0f)
+        {
+            m_Promotable.push_back(i);
+        }
+    }
+    std::sort(m_Promotable.begin(), m_Promotable.end(),
+        [this](size_t a, size_t b)
+        {
+            return m_Scores[a] > m_Scores[b] || (m_Scores[a] == m_Scores[b] && a < b);
+        });
+
+    // 1. Demotions, least important full agent first. A stratum without a
+    // sink keeps its first demoted agent as the sink; it stops being a full
+    // agent (and counts as demoted) once another firm merges into it.
+    std::sort(m_Candidates.begin(), m_Candidates.end(),
+        [this](size_t a, size_t b)
+        {
+            return m_Scores[a] < m_Scores[b] || (m_Scores[a] == m_Scores[b] && a < b);
+        });
+
+    m_SinkIsAgent.assign(sinkCount, 0);
+    int32_t demotedAgents = 0;
+    auto demote = [&](size_t row)
+    {
+        size_t key = GetRowSinkKey(companies, row);
+        if (clusterSink[key] >= 0)
+        {
+            demotions.push_back({ row, clusterSink[key], 0 });
+            demotedAgents++;
+        }
+        else if (rowSink[key] >= 0)
+        {
+            demotions.push_back({ row, -1, static_cast<size_t>(rowSink[key]) });
+            demotedAgents += m_SinkIsAgent[key] != 0 ? 2 : 1;
+            m_SinkIsAgent[key] = 0;
+        }
+        else
+        {
+            rowSink[key] = static_cast<int64_t>(row);
+            m_SinkIsAgent[key] = 1;
+        }
+    };
+
+    // Over the budget: the least important agents go, whatever their score
+    size_t next = 0;
+    while (next < m_Candidates.size() && fullAgents - demotedAgents > m_Config.m_FullAgentBudget)
+    {
+        demote(m_Candidates[next++]);
+    }
+
+    // Hysteresis: an agent below the demote threshold only makes room for a
+    // sampled firm above the promote threshold that the free budget cannot
+    // take anyway
+    int32_t important = 0;
+    for (size_t row : m_Promotable)
+    {
+        if (m_Scores[row] <= m_Config.m_PromoteThreshold)
+        {
+            break;
+        }
+        important++;
+    }
+    int32_t swaps = important - (m_Config.m_FullAgentBudget - (fullAgents - demotedAgents));
+    int32_t swapped = 0;
+    while (next < m_Candidates.size() && swapped < swaps && m_Scores[m_Candidates[next]] < m_Config.m_DemoteThreshold)
+    {
+        int32_t before = demotedAgents;
+        demote(m_Candidates[next++]);
+        swapped += demotedAgents - before;
+    }
+
+    // 2. Promotions: fill the free budget from the most important sampled
+    // rows, into the rows freed above. Each pass splits one agent off every
+    // row that still stands for two or more firms, until the budget is met.
+    int32_t fullAfter = fullAgents - demotedAgents;
+    size_t rowsAfter = count - demotions.size();
+    bool split = true;
+    while (split && fullAfter < m_Config.m_FullAgentBudget && rowsAfter < m_RowBudget)
+    {
+        split = false;
+        for (size_t row : m_Promotable)
+        {
+            if (fullAfter >= m_Config.m_FullAgentBudget || rowsAfter >= m_RowBudget)
+            {
+                break;
+            }
+
+            // Splitting a weight-2 row leaves two full agents
+            float weight = companies.GetWeights()[row];
+            int32_t added = weight == 2.0f ? 2 : 1;
+            if (weight < 2.0f || fullAfter + added > m_Config.m_FullAgentBudget)
+            {
+                continue;
+            }
+
+            uint32_t id = ids.Allocate();
+            if (id == CCompanyIDAllocator::INVALID_ID)
+            {
+                split = false;
+                break;
+            }
+
+            // Appends, so the planned row indices stay valid
+            companies.SplitCompany(row, id);
+            fullAfter += added;
+            rowsAfter++;
+            m_LastPromotions++;
+            split = true;
+        }
+    }
+
+    // 3. Move the demoted state, then drop the emptied rows from the back
+    m_Removed.clear();
+    for (const SDemotion& demotion : demotions)
+    {
+        if (demotion.m_Cluster >= 0)
+        {
+            clusters[demotion.m_Cluster].Absorb(companies.GetState(demotion.m_Row), companies.GetWeights()[demotion.m_Row]);
+            companies.SetWeight(demotion.m_Row, 0.0f);
+        }
+        else
+        {
+            companies.MergeCompany(demotion.m_Row, demotion.m_Into);
+        }
+        m_Removed.push_back(demotion.m_Row);
+    }
+
+    std::sort(m_Removed.begin(), m_Removed.end(), std::greater<size_t>());
+    for (size_t row : m_Removed)
+    {
+        ids.Release(companies.GetIDs()[row]);
+        companies.RemoveCompany(row);
+    }
+
+    m_LastDemotions = static_cast<int32_t>(demotions.size());
+    m_FullAgentCount = 0;
+    for (size_t i = 0; i < companies.GetCount(); ++i)
+    {
+        m_FullAgentCount += companies.GetWeights()[i] == 1.0f ? 1 : 0;
+    }
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,152 @@
+#include "Economy/CPolicyFile.h"
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace PoliticSim {
+
+namespace {
+
+std::string Trim(const std::string& text)
+{
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+    {
+        return std::string();
+    }
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+bool ParseFloat(const std::string& text, float& value)
+{
+    char* end = nullptr;
+    value = std::strtof(text.c_str(), &end);
+    return end != text.c_str() && *end == '\0';
+}
+
+bool ParseBool(const std::string& text, bool& value)
+{
+    if (text == "true" || text == "1")
+    {
+        value = true;
+        return true;
+    }
+    if (text == "false" || text == "0")
+    {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+bool CPolicyFile::Load(const std::string& path, SPolicyParams& params)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "Policy file: cannot open " << path << std::endl;
+        return false;
+    }
+    return Parse(file, path, params);
+}
+
+bool CPolicyFile::Parse(std::istream& input, const std::string& sourceName, SPolicyParams& params)
+{
+    std::string line;
+    int32_t lineNumber = 0;
+
+    while (std::getline(input, line))
+    {
+        lineNumber++;
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+        line = Trim(line);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        size_t separator = line.find('=');
+        if (separator == std::string::npos)
+        {
+            std::cerr << sourceName << ":" << lineNumber << ": expected Key = Value" << std::endl;
+            return false;
+        }
+
+        std::string key = Trim(line.substr(0, separator));
+        std::string value = Trim(line.substr(separator + 1));
+        bool parsed = false;
+
+        if (key == "CorporateTaxRate")
+            parsed = ParseFloat(value, params.m_CorporateTaxRate);
+        else if (key == "LaborTaxRate")
+            parsed = ParseFloat(value, params.m_LaborTaxRate);
+        else if (key == "MinimumWage")
+            parsed = ParseFloat(value, params.m_MinimumWage);
+        else if (key == "LaborRegulationBurden")
+            parsed = ParseFloat(value, params.m_LaborRegulationBurden);
+        else if (key == "EnvironmentalComplianceCost")
+            parsed = ParseFloat(value, params.m_EnvironmentalComplianceCost);
+        else if (key == "StrictEnvironmentalPolicy")
+            parsed = ParseBool(value, params.m_StrictEnvironmentalPolicy);
+        else if (key == "SubsidyRate")
+            parsed = ParseFloat(value, params.m_SubsidyRate);
+        else if (key == "SubsidiesEnabled")
+            parsed = ParseBool(value, params.m_SubsidiesEnabled);
+        else if (key == "TariffRate")
+            parsed = ParseFloat(value, params.m_TariffRate);
+        else
+        {
+            std::cerr << sourceName << ":" << lineNumber << ": unknown policy '" << key << "'" << std::endl;
+            return false;
+        }
+
+        if (!parsed)
+        {
+            std::cerr << sourceName << ":" << lineNumber << ": invalid value '" << value << "' for " << key << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CPolicyFile::Save(const std::string& path, const SPolicyParams& params)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cerr << "Policy file: cannot write " << path << std::endl;
+        return false;
+    }
+    Write(file, params);
+    return static_cast<bool>(file);
+}
+
+void CPolicyFile::Write(std::ostream& output, const SPolicyParams& params)
+{
+    // Enough digits that Load() restores the exact same floats
+    std::streamsize previousPrecision = output.precision(9);
+
+    output << "CorporateTaxRate = " << params.m_CorporateTaxRate << "\n";
+    output << "LaborTaxRate = " << params.m_LaborTaxRate << "\n";
+    output << "MinimumWage = " << params.m_MinimumWage << "\n";
+    output << "LaborRegulationBurden = " << params.m_LaborRegulationBurden << "\n";
+    output << "EnvironmentalComplianceCost = " << params.m_EnvironmentalComplianceCost << "\n";
+    output << "StrictEnvironmentalPolicy = " << (params.m_StrictEnvironmentalPolicy ? "true" : "false") << "\n";
+    output << "SubsidyRate = " << params.m_SubsidyRate << "\n";
+    output << "SubsidiesEnabled = " << (params.m_SubsidiesEnabled ? "true" : "false") << "\n";
+    output << "TariffRate = " << params.m_TariffRate << "\n";
+
+    output.precision(previousPrecision);
+}
+
+} // namespace PoliticSim
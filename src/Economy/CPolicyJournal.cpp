@@ -0,0 +1,200 @@
+#include "Economy/CPolicyJournal.h"
+#include "Save/CConfigChunks.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <cstring>
+
+namespace PoliticSim {
+
+CPolicyJournal::CPolicyJournal()
+    : m_Config()
+    , m_InitialPolicy()
+    , m_Changes()
+    , m_StateHashes()
+    , m_Recording(false)
+{
+}
+
+void CPolicyJournal::Start(const SEconomyConfig& config, const SPolicyParams& policy)
+{
+    m_Config = config;
+    m_InitialPolicy = policy;
+    m_Changes.clear();
+    m_StateHashes.clear();
+    m_Recording = true;
+}
+
+void CPolicyJournal::RecordPolicy(uint32_t tick, const SPolicyParams& before, const SPolicyParams& after)
+{
+    for (int32_t i = 0; i < static_cast<int32_t>(EPolicyField::COUNT); ++i)
+    {
+        SPolicyChange change;
+        change.m_Tick = tick;
+        change.m_Field = static_cast<EPolicyField>(i);
+        change.m_OldValue = GetField(before, change.m_Field);
+        change.m_NewValue = GetField(after, change.m_Field);
+
+        // Bitwise, so that replaying the journal restores the exact floats
+        if (std::memcmp(&change.m_OldValue, &change.m_NewValue, sizeof(float)) != 0)
+        {
+            m_Changes.push_back(change);
+        }
+    }
+}
+
+size_t CPolicyJournal::ApplyChanges(uint32_t tick, size_t next, SPolicyParams& policy) const
+{
+    while (next < m_Changes.size() && m_Changes[next].m_Tick <= tick)
+    {
+        SetField(policy, m_Changes[next].m_Field, m_Changes[next].m_NewValue);
+        ++next;
+    }
+    return next;
+}
+
+bool CPolicyJournal::Save(const std::string& path) const
+{
+    CSaveWriter writer;
+    if (!writer.Open(path))
+    {
+        return false;
+    }
+
+    writer.BeginChunk(SSaveFormat::MakeTag("JRNL"));
+    CConfigChunks::WriteConfig(writer, m_Config);
+    CConfigChunks::WritePolicy(writer, m_InitialPolicy);
+    writer.EndChunk();
+
+    writer.BeginChunk(SSaveFormat::MakeTag("JPOL"));
+    writer.Write(static_cast<uint64_t>(m_Changes.size()));
+    for (const SPolicyChange& change : m_Changes)
+    {
+        writer.Write(change.m_Tick);
+        writer.Write(change.m_Field);
+        writer.Write(change.m_OldValue);
+        writer.Write(change.m_NewValue);
+    }
+    writer.EndChunk();
+
+    writer.BeginChunk(SSaveFormat::MakeTag("JHSH"));
+    writer.Write(static_cast<uint64_t>(m_StateHashes.size()));
+    writer.WriteArray(m_StateHashes.data(), m_StateHashes.size());
+    writer.EndChunk();
+    return writer.Close();
+}
+
+bool CPolicyJournal::Load(const std::string& path)
+{
+    CSaveReader reader;
+    if (!reader.Open(path) || !reader.BeginChunk(SSaveFormat::MakeTag("JRNL")))
+    {
+        return false;
+    }
+
+    SEconomyConfig config;
+    SPolicyParams initialPolicy;
+    CConfigChunks::ReadConfig(reader, config);
+    CConfigChunks::ReadPolicy(reader, initialPolicy);
+    reader.EndChunk();
+
+    std::vector<SPolicyChange> changes;
+    if (reader.BeginChunk(SSaveFormat::MakeTag("JPOL")))
+    {
+        uint64_t count = reader.Read<uint64_t>();
+        for (uint64_t i = 0; i < count && reader.IsGood(); ++i)
+        {
+            SPolicyChange change;
+            reader.Read(change.m_Tick);
+            reader.Read(change.m_Field);
+            reader.Read(change.m_OldValue);
+            reader.Read(change.m_NewValue);
+
+            if (change.m_Field >= EPolicyField::COUNT || (!changes.empty() && change.m_Tick < changes.back().m_Tick))
+            {
+                reader.Fail("bad policy change");
+            }
+            changes.push_back(change);
+        }
+        reader.EndChunk();
+    }
+
+    std::vector<uint64_t> hashes;
+    if (reader.IsGood() && reader.BeginChunk(SSaveFormat::MakeTag("JHSH")))
+    {
+        size_t count = static_cast<size_t>(reader.Read<uint64_t>());
+        if (const uint64_t* values = reader.ReadArray<uint64_t>(count))
+        {
+            hashes.assign(values, values + count);
+        }
+        reader.EndChunk();
+    }
+
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+
+    config.m_WorkerThreads = m_Config.m_WorkerThreads;
+    m_Config = config;
+    m_InitialPolicy = initialPolicy;
+    m_Changes = std::move(changes);
+    m_StateHashes = std::move(hashes);
+    m_Recording = false;
+    return true;
+}
+
+float CPolicyJournal::GetField(const SPolicyParams& policy, EPolicyField field)
+{
+    switch (field)
+    {
+        case EPolicyField::CorporateTaxRate:            return policy.m_CorporateTaxRate;
+        case EPolicyField::LaborTaxRate:                return policy.m_LaborTaxRate;
+        case EPolicyField::MinimumWage:                 return policy.m_MinimumWage;
+        case EPolicyField::LaborRegulationBurden:       return policy.m_LaborRegulationBurden;
+        case EPolicyField::EnvironmentalComplianceCost: return policy.m_EnvironmentalComplianceCost;
+        case EPolicyField::StrictEnvironmentalPolicy:   return policy.m_StrictEnvironmentalPolicy ? 1.0f : 0.0f;
+        case EPolicyField::SubsidyRate:                 return policy.m_SubsidyRate;
+        case EPolicyField::SubsidiesEnabled:            return policy.m_SubsidiesEnabled ? 1.0f : 0.0f;
+        case EPolicyField::TariffRate:                  return policy.m_TariffRate;
+        case EPolicyField::COUNT:                       break;
+    }
+    return 0.0f;
+}
+
+void CPolicyJournal::SetField(SPolicyParams& policy, EPolicyField field, float value)
+{
+    switch (field)
+    {
+        case EPolicyField::CorporateTaxRate:            policy.m_CorporateTaxRate = value; break;
+        case EPolicyField::LaborTaxRate:                policy.m_LaborTaxRate = value; break;
+        case EPolicyField::MinimumWage:                 policy.m_MinimumWage = value; break;
+        case EPolicyField::LaborRegulationBurden:       policy.m_LaborRegulationBurden = value; break;
+        case EPolicyField::EnvironmentalComplianceCost: policy.m_EnvironmentalComplianceCost = value; break;
+        case EPolicyField::StrictEnvironmentalPolicy:   policy.m_StrictEnvironmentalPolicy = value != 0.0f; break;
+        case EPolicyField::SubsidyRate:                 policy.m_SubsidyRate = value; break;
+        case EPolicyField::SubsidiesEnabled:            policy.m_SubsidiesEnabled = value != 0.0f; break;
+        case EPolicyField::TariffRate:                  policy.m_TariffRate = value; break;
+        case EPolicyField::COUNT:                       break;
+    }
+}
+
+const char* CPolicyJournal::GetFieldName(EPolicyField field)
+{
+    // Same names as the keys of CPolicyFile
+    switch (field)
+    {
+        case EPolicyField::CorporateTaxRate:            return "CorporateTaxRate";
+        case EPolicyField::LaborTaxRate:                return "LaborTaxRate";
+        case EPolicyField::MinimumWage:                 return "MinimumWage";
+        case EPolicyField::LaborRegulationBurden:       return "LaborRegulationBurden";
+        case EPolicyField::EnvironmentalComplianceCost: return "EnvironmentalComplianceCost";
+        case EPolicyField::StrictEnvironmentalPolicy:   return "StrictEnvironmentalPolicy";
+        case EPolicyField::SubsidyRate:                 return "SubsidyRate";
+        case EPolicyField::SubsidiesEnabled:            return "SubsidiesEnabled";
+        case EPolicyField::TariffRate:                  return "TariffRate";
+        case EPolicyField::COUNT:                       break;
+    }
+    return "Unknown";
+}
+
+} // namespace PoliticSim
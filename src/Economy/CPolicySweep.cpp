@@ -0,0 +1,222 @@
+#include "Economy/CPolicySweep.h"
+#include "Economy/CEconomyManager.h"
+#include "Economy/CEconomyProjection.h"
+#include "Save/CConfigChunks.h"
+#include "Save/CSaveWriter.h"
+#include "Threading/CWorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+namespace PoliticSim {
+
+namespace {
+
+// Starting world of one seed, built by the first run that needs it and
+// freed by the last
+struct SSeedWorld
+{
+    std::once_flag m_Built;
+    std::unique_ptr<CEconomyManager> m_World;
+    std::atomic<size_t> m_RunsLeft;
+};
+
+} // namespace
+
+CPolicySweep::CPolicySweep()
+    : m_Config()
+    , m_Policies()
+    , m_Seeds()
+    , m_Months(0)
+    , m_Runs()
+    , m_Bands()
+{
+}
+
+void CPolicySweep::Configure(const SEconomyConfig& config, const std::vector<SPolicyParams>& policies,
+                             const std::vector<uint64_t>& seeds, int32_t months)
+{
+    m_Config = config;
+    m_Config.m_WorkerThreads = 1;
+    m_Policies = policies;
+    m_Seeds = seeds;
+    m_Months = std::max(months, 0);
+    m_Runs.clear();
+    m_Bands.clear();
+}
+
+bool CPolicySweep::Run(size_t threadCount, const std::string& resultPath)
+{
+    size_t policyCount = m_Policies.size();
+    size_t runCount = policyCount * m_Seeds.size();
+    m_Runs.assign(runCount, SProjectionSeries());
+    m_Bands.clear();
+
+    CSaveWriter writer;
+    bool writing = !resultPath.empty();
+    if (writing)
+    {
+        if (!writer.Open(resultPath))
+        {
+            return false;
+        }
+        WriteHeader(writer);
+        writer.BeginChunk(SSaveFormat::MakeTag("SRUN"));
+    }
+
+    std::vector<SSeedWorld> worlds(m_Seeds.size());
+    for (SSeedWorld& world : worlds)
+    {
+        world.m_RunsLeft.store(policyCount, std::memory_order_relaxed);
+    }
+
+    // Finished runs go to the file in run order
+    std::mutex writeMutex;
+    std::vector<uint8_t> finished(runCount, 0);
+    size_t nextWrite = 0;
+
+    // One run per chunk: runs of one seed are adjacent, so only about one
+    // seed world per thread is alive at a time
+    CWorkerPool pool(threadCount > 0 ? threadCount : CWorkerPool::GetDefaultThreadCount());
+    pool.ParallelFor(runCount, 1,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t run = begin; run < end; ++run)
+            {
+                size_t seed = run / policyCount;
+                const SPolicyParams& policy = m_Policies[run % policyCount];
+                SSeedWorld& world = worlds[seed];
+                std::call_once(world.m_Built,
+                    [this, &world, seed]()
+                    {
+                        SEconomyConfig config = m_Config;
+                        config.m_WorldSeed = m_Seeds[seed];
+                        world.m_World = std::make_unique<CEconomyManager>(1);
+                        world.m_World->Initialize(config);
+                    });
+
+                // The month-0 macro state depends on the policy (tariffs),
+                // so it is recomputed after the switch
+                std::unique_ptr<CEconomyManager> fork = world.m_World->Fork();
+                fork->SetPolicyParams(policy);
+                fork->UpdateMacroState();
+
+                SProjectionSeries& series = m_Runs[run];
+                series.m_Policy = policy;
+                for (int32_t month = 0; month < m_Months; ++month)
+                {
+                    fork->AdvanceMonth();
+                    CEconomyProjection::AppendMonth(*fork, series);
+                }
+                fork.reset();
+
+                // Nothing shares the seed world once its last fork is gone
+                if (world.m_RunsLeft.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    world.m_World.reset();
+                }
+
+                std::lock_guard<std::mutex> lock(writeMutex);
+                finished[run] = 1;
+                for (; nextWrite < runCount && finished[nextWrite] != 0; ++nextWrite)
+                {
+                    if (writing)
+                    {
+                        WriteRun(writer, nextWrite);
+                    }
+                }
+            }
+        });
+
+    ComputeBands();
+    if (!writing)
+    {
+        return true;
+    }
+
+    writer.EndChunk();
+    WriteBands(writer);
+    return writer.Close();
+}
+
+void CPolicySweep::ComputeBands()
+{
+    size_t seedCount = m_Seeds.size();
+    size_t months = static_cast<size_t>(m_Months);
+    m_Bands.assign(m_Policies.size() * METRIC_COUNT, SSweepBand());
+
+    for (size_t policy = 0; policy < m_Policies.size(); ++policy)
+    {
+        for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+        {
+            SSweepBand& band = m_Bands[policy * METRIC_COUNT + metric];
+            band.m_Mean.resize(months);
+            band.m_Low.resize(months);
+            band.m_High.resize(months);
+
+            for (size_t month = 0; month < months; ++month)
+            {
+                // Two passes in double, so large totals do not cancel
+                double sum = 0.0;
+                for (size_t seed = 0; seed < seedCount; ++seed)
+                {
+                    sum += GetRun(policy, seed).GetMetric(static_cast<EProjectionMetric>(metric))[month];
+                }
+                double mean = seedCount > 0 ? sum / seedCount : 0.0;
+
+                double squares = 0.0;
+                for (size_t seed = 0; seed < seedCount; ++seed)
+                {
+                    double deviation = GetRun(policy, seed).GetMetric(static_cast<EProjectionMetric>(metric))[month] - mean;
+                    squares += deviation * deviation;
+                }
+
+                // Standard error of the mean (sample variance; one seed has no band)
+                double standardError = seedCount > 1 ? std::sqrt(squares / (seedCount - 1) / seedCount) : 0.0;
+                band.m_Mean[month] = static_cast<float>(mean);
+                band.m_Low[month] = static_cast<float>(mean - CONFIDENCE_Z * standardError);
+                band.m_High[month] = static_cast<float>(mean + CONFIDENCE_Z * standardError);
+            }
+        }
+    }
+}
+
+void CPolicySweep::WriteHeader(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("SWEP"));
+    CConfigChunks::WriteConfig(writer, m_Config);
+    writer.Write(m_Months);
+    writer.Write(static_cast<uint64_t>(m_Policies.size()));
+    writer.Write(static_cast<uint64_t>(m_Seeds.size()));
+    for (const SPolicyParams& policy : m_Policies)
+    {
+        CConfigChunks::WritePolicy(writer, policy);
+    }
+    writer.WriteArray(m_Seeds.data(), m_Seeds.size());
+    writer.EndChunk();
+}
+
+void CPolicySweep::WriteRun(CSaveWriter& writer, size_t run) const
+{
+    for (int32_t metric = 0; metric < METRIC_COUNT; ++metric)
+    {
+        const std::vector<float>& values = m_Runs[run].GetMetric(static_cast<EProjectionMetric>(metric));
+        writer.WriteArray(values.data(), values.size());
+    }
+}
+
+void CPolicySweep::WriteBands(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("SBND"));
+    for (const SSweepBand& band : m_Bands)
+    {
+        writer.WriteArray(band.m_Mean.data(), band.m_Mean.size());
+        writer.WriteArray(band.m_Low.data(), band.m_Low.size());
+        writer.WriteArray(band.m_High.data(), band.m_High.size());
+    }
+    writer.EndChunk();
+}
+
+} // namespace PoliticSim
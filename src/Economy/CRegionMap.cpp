@@ -0,0 +1,197 @@
+#include "Economy/CRegionMap.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace PoliticSim {
+
+CRegionMap::CRegionMap()
+{
+    Configure(std::vector<SRegionConfig>());
+}
+
+bool CRegionMap::Configure(const std::vector<SRegionConfig>& regions)
+{
+    m_Regions.clear();
+    m_Leaves.clear();
+
+    bool valid = true;
+    std::vector<bool> hasChildren(regions.size(), false);
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        // Parents come first, so one backward pass folds the whole tree
+        int32_t parent = regions[i].m_Parent;
+        if (parent < -1 || parent >= static_cast<int32_t>(i))
+        {
+            std::cerr << "Region " << i << " (" << regions[i].m_Name << "): parent " << parent
+                      << " must be -1 or a lower region index" << std::endl;
+            valid = false;
+            break;
+        }
+        if (parent >= 0)
+        {
+            hasChildren[parent] = true;
+        }
+    }
+
+    if (valid)
+    {
+        m_Regions = regions;
+        for (size_t i = 0; i < regions.size(); ++i)
+        {
+            if (!hasChildren[i])
+            {
+                m_Leaves.push_back(static_cast<int32_t>(i));
+            }
+        }
+
+        if (static_cast<int32_t>(m_Leaves.size()) > MAX_LEAVES)
+        {
+            std::cerr << "Too many leaf regions (" << m_Leaves.size() << ", max " << MAX_LEAVES << ")" << std::endl;
+            valid = false;
+        }
+    }
+
+    if (!valid || m_Regions.empty())
+    {
+        m_Regions.assign(1, SRegionConfig("National", -1, 1.0f));
+        m_Leaves.assign(1, 0);
+    }
+
+    m_LeafOfRegion.assign(m_Regions.size(), -1);
+    for (size_t leaf = 0; leaf < m_Leaves.size(); ++leaf)
+    {
+        m_LeafOfRegion[m_Leaves[leaf]] = static_cast<int32_t>(leaf);
+    }
+
+    m_LeafBegin.assign(m_Leaves.size() + 1, 0);
+    m_MacroStates.assign(m_Regions.size(), SMacroState());
+    m_Aggregates.assign(m_Regions.size(), SCompanyAggregates());
+    return valid;
+}
+
+std::vector<int64_t> CRegionMap::SplitByShare(int64_t total) const
+{
+    size_t leafCount = m_Leaves.size();
+    std::vector<int64_t> counts(leafCount, 0);
+
+    double shareSum = 0.0;
+    for (int32_t region : m_Leaves)
+    {
+        shareSum += std::max(m_Regions[region].m_CompanyShare, 0.0f);
+    }
+    if (shareSum <= 0.0)
+    {
+        counts[0] = total;
+        return counts;
+    }
+
+    // Largest remainder, ties to the lower leaf
+    std::vector<double> remainders(leafCount, 0.0);
+    int64_t assigned = 0;
+    for (size_t leaf = 0; leaf < leafCount; ++leaf)
+    {
+        double exact = total * std::max(m_Regions[m_Leaves[leaf]].m_CompanyShare, 0.0f) / shareSum;
+        counts[leaf] = static_cast<int64_t>(std::floor(exact));
+        remainders[leaf] = exact - std::floor(exact);
+        assigned += counts[leaf];
+    }
+
+    std::vector<size_t> order(leafCount);
+    for (size_t leaf = 0; leaf < leafCount; ++leaf)
+    {
+        order[leaf] = leaf;
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [&remainders](size_t a, size_t b)
+        {
+            return remainders[a] > remainders[b];
+        });
+
+    for (size_t i = 0; assigned < total; i = (i + 1) % leafCount)
+    {
+        counts[order[i]]++;
+        assigned++;
+    }
+
+    return counts;
+}
+
+void CRegionMap::SetLeafRanges(const uint16_t* leaves, size_t count)
+{
+    std::fill(m_LeafBegin.begin(), m_LeafBegin.end(), 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_LeafBegin[leaves[i] + 1]++;
+    }
+    for (size_t leaf = 1; leaf < m_LeafBegin.size(); ++leaf)
+    {
+        m_LeafBegin[leaf] += m_LeafBegin[leaf - 1];
+    }
+}
+
+void CRegionMap::Save(CSaveWriter& writer) const
+{
+    writer.BeginChunk(SSaveFormat::MakeTag("RGNS"));
+    writer.Write(static_cast<uint32_t>(m_Regions.size()));
+    writer.WriteArray(m_MacroStates.data(), m_MacroStates.size());
+    writer.WriteArray(m_Aggregates.data(), m_Aggregates.size());
+    writer.EndChunk();
+}
+
+bool CRegionMap::Load(CSaveReader& reader)
+{
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("RGNS")))
+    {
+        return false;
+    }
+
+    size_t count = reader.Read<uint32_t>();
+    if (reader.IsGood() && count != m_Regions.size())
+    {
+        reader.Fail("region count does not match the hierarchy");
+    }
+
+    const SMacroState* macroStates = reader.ReadArray<SMacroState>(count);
+    const SCompanyAggregates* aggregates = reader.ReadArray<SCompanyAggregates>(count);
+    if (macroStates != nullptr && aggregates != nullptr)
+    {
+        m_MacroStates.assign(macroStates, macroStates + count);
+        m_Aggregates.assign(aggregates, aggregates + count);
+    }
+    reader.EndChunk();
+    return reader.IsGood();
+}
+
+SCompanyAggregates CRegionMap::AggregateUp()
+{
+    // Inner regions only hold what their children add
+    for (int32_t region = 0; region < GetRegionCount(); ++region)
+    {
+        if (!IsLeaf(region))
+        {
+            m_Aggregates[region] = SCompanyAggregates();
+        }
+    }
+
+    // Children have higher indices than their parents
+    SCompanyAggregates national;
+    for (size_t region = m_Regions.size(); region-- > 0;)
+    {
+        int32_t parent = m_Regions[region].m_Parent;
+        if (parent >= 0)
+        {
+            m_Aggregates[parent].Merge(m_Aggregates[region]);
+        }
+        else
+        {
+            national.Merge(m_Aggregates[region]);
+        }
+    }
+
+    return national;
+}
+
+} // namespace PoliticSim
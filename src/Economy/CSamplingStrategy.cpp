@@ -0,0 +1,181 @@
+#include "Economy/CSamplingStrategy.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace PoliticSim {
+
+void CSamplingStrategy::Clear()
+{
+    for (SStratumSample& stratum : m_Strata)
+    {
+        stratum = SStratumSample();
+    }
+}
+
+void CSamplingStrategy::SetPopulation(ESector sector, ECompanySize size, int64_t population, float variability)
+{
+    SStratumSample& stratum = m_Strata[GetStratumIndex(sector, size)];
+    stratum.m_Population = std::max<int64_t>(population, 0);
+    stratum.m_Variability = std::max(variability, 0.0f);
+    stratum.m_SampleSize = 0;
+    stratum.m_Weight = 0.0f;
+}
+
+void CSamplingStrategy::Allocate(int32_t sampleBudget, int32_t minimumPerStratum)
+{
+    int64_t budget = std::max(sampleBudget, 0);
+
+    // 1. Guaranteed minimum, so no populated stratum goes unobserved
+    int64_t minimumTotal = 0;
+    for (SStratumSample& stratum : m_Strata)
+    {
+        stratum.m_SampleSize = static_cast<int32_t>(std::min<int64_t>(stratum.m_Population, std::max(minimumPerStratum, 0)));
+        minimumTotal += stratum.m_SampleSize;
+    }
+
+    if (minimumTotal > budget)
+    {
+        // Not enough for the minimums: plain Neyman allocation from zero
+        for (SStratumSample& stratum : m_Strata)
+        {
+            stratum.m_SampleSize = 0;
+        }
+    }
+    else
+    {
+        budget -= minimumTotal;
+    }
+
+    // 2. Neyman allocation of the rest. Strata that reach their population
+    // are closed and the remainder is shared again among the open ones.
+    double remainders[STRATUM_COUNT];
+    while (budget > 0)
+    {
+        double totalScore = 0.0;
+        for (const SStratumSample& stratum : m_Strata)
+        {
+            if (stratum.m_SampleSize < stratum.m_Population)
+            {
+                totalScore += static_cast<double>(stratum.m_Population) * stratum.m_Variability;
+            }
+        }
+        if (totalScore <= 0.0)
+        {
+            break;
+        }
+
+        int64_t allocated = 0;
+        for (int32_t i = 0; i < STRATUM_COUNT; ++i)
+        {
+            SStratumSample& stratum = m_Strata[i];
+            remainders[i] = -1.0;
+            if (stratum.m_SampleSize >= stratum.m_Population)
+            {
+                continue;
+            }
+
+            double share = static_cast<double>(budget) * stratum.m_Population * stratum.m_Variability / totalScore;
+            int64_t add = std::min(static_cast<int64_t>(std::floor(share)), stratum.m_Population - stratum.m_SampleSize);
+            stratum.m_SampleSize += static_cast<int32_t>(add);
+            allocated += add;
+            remainders[i] = share - std::floor(share);
+        }
+
+        if (allocated == 0)
+        {
+            // Fewer companies left than open strata: largest remainders first
+            while (budget > 0)
+            {
+                int32_t best = -1;
+                for (int32_t i = 0; i < STRATUM_COUNT; ++i)
+                {
+                    if (remainders[i] >= 0.0 && (best < 0 || remainders[i] > remainders[best]))
+                    {
+                        best = i;
+                    }
+                }
+                if (best < 0)
+                {
+                    break;
+                }
+                m_Strata[best].m_SampleSize++;
+                remainders[best] = -1.0;
+                budget--;
+            }
+            break;
+        }
+
+        budget -= allocated;
+    }
+
+    // 3. Extrapolation weights
+    for (SStratumSample& stratum : m_Strata)
+    {
+        stratum.m_Weight = stratum.m_SampleSize > 0
+            ? static_cast<float>(static_cast<double>(stratum.m_Population) / stratum.m_SampleSize)
+            : 0.0f;
+    }
+}
+
+void CSamplingStrategy::Save(CSaveWriter& writer) const
+{
+    // Field by field: the struct's padding would otherwise leak into the file
+    writer.BeginChunk(SSaveFormat::MakeTag("STRA"));
+    for (const SStratumSample& stratum : m_Strata)
+    {
+        writer.Write(stratum.m_Population);
+        writer.Write(stratum.m_Variability);
+        writer.Write(stratum.m_SampleSize);
+        writer.Write(stratum.m_Weight);
+    }
+    writer.EndChunk();
+}
+
+bool CSamplingStrategy::Load(CSaveReader& reader)
+{
+    if (!reader.BeginChunk(SSaveFormat::MakeTag("STRA")))
+    {
+        return false;
+    }
+
+    SStratumSample strata[STRATUM_COUNT];
+    for (SStratumSample& stratum : strata)
+    {
+        reader.Read(stratum.m_Population);
+        reader.Read(stratum.m_Variability);
+        reader.Read(stratum.m_SampleSize);
+        reader.Read(stratum.m_Weight);
+    }
+    reader.EndChunk();
+
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+    std::copy(strata, strata + STRATUM_COUNT, m_Strata);
+    return true;
+}
+
+int64_t CSamplingStrategy::GetTotalPopulation() const
+{
+    int64_t total = 0;
+    for (const SStratumSample& stratum : m_Strata)
+    {
+        total += stratum.m_Population;
+    }
+    return total;
+}
+
+int32_t CSamplingStrategy::GetTotalSampleSize() const
+{
+    int32_t total = 0;
+    for (const SStratumSample& stratum : m_Strata)
+    {
+        total += stratum.m_SampleSize;
+    }
+    return total;
+}
+
+} // namespace PoliticSim
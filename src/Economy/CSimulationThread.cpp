@@ -0,0 +1,340 @@
+#include "Economy/CSimulationThread.h"
+#include "Economy/CCompanyStore.h"
+
+namespace PoliticSim {
+
+CSimulationThread::CSimulationThread(CEconomyManager& economy)
+    : m_Economy(economy)
+    , m_Thread()
+    , m_Inline(false)
+    , m_Running(false)
+    , m_WakeCount(0)
+    , m_SelectedID(-1)
+    , m_Projection()
+    , m_ProjectionSeries()
+    , m_TableIndex()
+    , m_UnsentGameDelta(0.0f)
+    , m_HasUnsentPolicy(false)
+    , m_UnsentPolicy()
+    , m_HasUnsentSelection(false)
+    , m_UnsentSelection(-1)
+    , m_HasUnsentProjection(false)
+    , m_UnsentProjectionPolicy()
+    , m_UnsentProjectionMonths(0)
+    , m_HasUnsentTableQuery(false)
+    , m_UnsentTableQuery()
+{
+}
+
+CSimulationThread::~CSimulationThread()
+{
+    Stop();
+}
+
+void CSimulationThread::Start(bool threaded)
+{
+    if (IsRunning())
+    {
+        return;
+    }
+
+    // The UI has a valid snapshot from its first frame
+    PublishSnapshot();
+
+    if (!threaded)
+    {
+        m_Inline = true;
+        m_Economy.SetTimeSlicing(true);
+        return;
+    }
+
+    m_Running.store(true, std::memory_order_release);
+    m_Thread = std::thread(&CSimulationThread::Run, this);
+}
+
+void CSimulationThread::Stop()
+{
+    if (m_Inline)
+    {
+        m_Inline = false;
+        m_Economy.SetTimeSlicing(false);
+        m_Projection.Cancel();
+        return;
+    }
+
+    if (!IsThreaded())
+    {
+        return;
+    }
+
+    m_Running.store(false, std::memory_order_release);
+    WakeUp();
+    m_Thread.join();
+}
+
+void CSimulationThread::AdvanceTime(float gameDelta)
+{
+    m_UnsentGameDelta += gameDelta;
+    Flush();
+}
+
+void CSimulationThread::SetPolicy(const SPolicyParams& policy)
+{
+    m_UnsentPolicy = policy;
+    m_HasUnsentPolicy = true;
+    Flush();
+}
+
+void CSimulationThread::SelectCompany(int32_t companyID)
+{
+    m_UnsentSelection = companyID;
+    m_HasUnsentSelection = true;
+    Flush();
+}
+
+void CSimulationThread::QueryTable(const SCompanyTableQuery& query)
+{
+    m_UnsentTableQuery = query;
+    m_HasUnsentTableQuery = true;
+    Flush();
+}
+
+void CSimulationThread::Project(const SPolicyParams& policy, int32_t months)
+{
+    m_UnsentProjectionPolicy = policy;
+    m_UnsentProjectionMonths = months;
+    m_HasUnsentProjection = true;
+    Flush();
+}
+
+void CSimulationThread::WakeUp()
+{
+    m_WakeCount.fetch_add(1, std::memory_order_release);
+    m_WakeCount.notify_one();
+}
+
+void CSimulationThread::Flush()
+{
+    bool queued = false;
+    SSimulationCommand command;
+
+    if (m_UnsentGameDelta > 0.0f)
+    {
+        command.m_Type = ESimulationCommand::AdvanceTime;
+        command.m_GameDelta = m_UnsentGameDelta;
+        if (m_Commands.TryPush(command))
+        {
+            m_UnsentGameDelta = 0.0f;
+            queued = true;
+        }
+    }
+
+    if (m_HasUnsentPolicy)
+    {
+        command.m_Type = ESimulationCommand::SetPolicy;
+        command.m_Policy = m_UnsentPolicy;
+        if (m_Commands.TryPush(command))
+        {
+            m_HasUnsentPolicy = false;
+            queued = true;
+        }
+    }
+
+    if (m_HasUnsentSelection)
+    {
+        command.m_Type = ESimulationCommand::SelectCompany;
+        command.m_CompanyID = m_UnsentSelection;
+        if (m_Commands.TryPush(command))
+        {
+            m_HasUnsentSelection = false;
+            queued = true;
+        }
+    }
+
+    if (m_HasUnsentProjection)
+    {
+        command.m_Type = ESimulationCommand::Project;
+        command.m_Policy = m_UnsentProjectionPolicy;
+        command.m_Months = m_UnsentProjectionMonths;
+        if (m_Commands.TryPush(command))
+        {
+            m_HasUnsentProjection = false;
+            queued = true;
+        }
+    }
+
+    if (m_HasUnsentTableQuery)
+    {
+        command.m_Type = ESimulationCommand::QueryTable;
+        command.m_TableQuery = m_UnsentTableQuery;
+        if (m_Commands.TryPush(command))
+        {
+            m_HasUnsentTableQuery = false;
+            queued = true;
+        }
+    }
+
+    if (queued)
+    {
+        WakeUp();
+    }
+}
+
+void CSimulationThread::Run()
+{
+    while (m_Running.load(std::memory_order_acquire))
+    {
+        // Read before draining: a command pushed after the drain bumps the
+        // count, so the wait below returns immediately
+        uint32_t wakeCount = m_WakeCount.load(std::memory_order_acquire);
+        ProcessCommands();
+
+        // Keep working off owed months between command batches
+        while (m_Economy.GetPendingMonths() > 0 && m_WakeCount.load(std::memory_order_acquire) == wakeCount)
+        {
+            uint32_t tick = m_Economy.GetTick();
+            m_Economy.Update(0.0f);
+            if (m_Economy.GetTick() != tick)
+            {
+                PublishSnapshot();
+            }
+        }
+
+        if (m_Economy.GetPendingMonths() == 0)
+        {
+            m_WakeCount.wait(wakeCount, std::memory_order_acquire);
+        }
+    }
+
+    // Forks are dropped on the thread that owns the economy
+    m_Projection.Cancel();
+}
+
+void CSimulationThread::Pump()
+{
+    if (m_Inline)
+    {
+        ProcessCommands();
+    }
+}
+
+void CSimulationThread::ProcessCommands()
+{
+    // Snapshots only go out when a month has committed or the UI asked for
+    // something, never for a month still in progress
+    uint32_t tick = m_Economy.GetTick();
+    bool changed = false;
+
+    SSimulationCommand command;
+    while (m_Commands.TryPop(command))
+    {
+        changed |= ApplyCommand(command);
+    }
+
+    // A finished projection wakes this thread (see ApplyCommand)
+    changed |= m_Projection.TakeResult(m_ProjectionSeries);
+
+    if (changed || m_Economy.GetTick() != tick)
+    {
+        PublishSnapshot();
+    }
+}
+
+bool CSimulationThread::ApplyCommand(const SSimulationCommand& command)
+{
+    switch (command.m_Type)
+    {
+        case ESimulationCommand::AdvanceTime:
+            m_Economy.Update(command.m_GameDelta);
+            return false;
+
+        case ESimulationCommand::SetPolicy:
+            m_Economy.SetPolicyParams(command.m_Policy);
+            return true;
+
+        case ESimulationCommand::SelectCompany:
+            m_SelectedID = command.m_CompanyID;
+            return true;
+
+        case ESimulationCommand::Project:
+            m_Projection.Start(m_Economy, command.m_Policy, command.m_Months, [this]() { WakeUp(); });
+            return false;
+
+        case ESimulationCommand::QueryTable:
+            m_TableIndex.SetQuery(command.m_TableQuery);
+            return true;
+    }
+    return false;
+}
+
+void CSimulationThread::PublishSnapshot()
+{
+    SEconomySnapshot& snapshot = m_Snapshots.GetBack();
+    const CCompanyStore& companies = m_Economy.GetCompanyStore();
+    size_t count = companies.GetCount();
+
+    snapshot.m_Tick = m_Economy.GetTick();
+    snapshot.m_PendingMonths = m_Economy.GetPendingMonths();
+    snapshot.m_MacroState = m_Economy.GetMacroState();
+    snapshot.m_PolicyParams = m_Economy.GetPolicyParams();
+    snapshot.m_RepresentedCompanies = m_Economy.GetRepresentedCompanyCount();
+    snapshot.m_TotalEmployment = m_Economy.GetTotalEmployment();
+    snapshot.m_TotalGDP = m_Economy.GetTotalGDP();
+    snapshot.m_AverageProfitability = m_Economy.GetAverageProfitability();
+    snapshot.m_Projection = m_ProjectionSeries;
+
+    // Columns keep their capacity, so steady-state publishing does not
+    // allocate. Rows of closed firms awaiting compaction are left out.
+    snapshot.m_IDs.clear();
+    snapshot.m_Sectors.clear();
+    snapshot.m_Sizes.clear();
+    snapshot.m_Employees.clear();
+    snapshot.m_Profitability.clear();
+    snapshot.m_Liquidity.clear();
+    snapshot.m_States.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (companies.IsClosed(i))
+        {
+            continue;
+        }
+        snapshot.m_IDs.push_back(companies.GetIDs()[i]);
+        snapshot.m_Sectors.push_back(companies.GetSectors()[i]);
+        snapshot.m_Sizes.push_back(companies.GetSizes()[i]);
+        snapshot.m_Employees.push_back(companies.GetEmployees()[i]);
+        snapshot.m_Profitability.push_back(companies.GetProfitability()[i]);
+        snapshot.m_Liquidity.push_back(companies.GetLiquidity()[i]);
+        snapshot.m_States.push_back(companies.GetStates()[i]);
+    }
+
+    // Re-sorted only when a tick completed or the query changed
+    m_TableIndex.Update(snapshot);
+    snapshot.m_TableQuery = m_TableIndex.GetQuery();
+    snapshot.m_TableRows.assign(m_TableIndex.GetRows().begin(), m_TableIndex.GetRows().end());
+
+    // Selected company
+    snapshot.m_SelectedID = m_SelectedID;
+    size_t selected = m_SelectedID >= 0 ? m_Economy.FindCompany(static_cast<uint32_t>(m_SelectedID))
+                                        : CCompanyStore::INVALID_ROW;
+    snapshot.m_SelectedFound = selected != CCompanyStore::INVALID_ROW;
+    if (snapshot.m_SelectedFound)
+    {
+        const CHistoryStore& history = companies.GetHistory();
+        snapshot.m_SelectedAttributes = companies.GetAttributes(selected);
+        snapshot.m_SelectedState = companies.GetState(selected);
+        snapshot.m_HistoryMonths = history.GetDepth();
+        for (int32_t metric = 0; metric < SEconomySnapshot::METRIC_COUNT; ++metric)
+        {
+            snapshot.m_HistoryRecorded[metric] = history.IsRecorded(static_cast<EHistoryMetric>(metric));
+            snapshot.m_History[metric].resize(static_cast<size_t>(snapshot.m_HistoryMonths));
+            if (snapshot.m_HistoryRecorded[metric])
+            {
+                history.CopySeries(static_cast<EHistoryMetric>(metric), selected, snapshot.m_History[metric].data());
+            }
+        }
+    }
+
+    m_Snapshots.Publish();
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,488 @@
+#include "Economy/CEconomyManager.h"
+#include "Economy/CPolicyFile.h"
+#include "Economy/CPolicyJournal.h"
+#include "Economy/CPolicySweep.h"
+#include "Economy/SEconomyConfig.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace PoliticSim;
+
+namespace {
+
+// One policy field of a sweep grid and the values it takes
+struct SSweepAxis
+{
+    EPolicyField m_Field;
+    std::vector<float> m_Values;
+};
+
+struct SHeadlessOptions
+{
+    SEconomyConfig m_Config;
+    int32_t m_Months;           // Default: 120
+    int32_t m_ReportInterval;   // Default: 12 (months between progress lines, 0 = none)
+    std::string m_PolicyPath;   // Default: empty (SPolicyParams defaults)
+    int64_t m_MicroFirms;       // Default: 0 (no aggregate clusters)
+    int32_t m_Regions;          // Default: 1 (leaf regions of equal share)
+    std::string m_LoadPath;     // Default: empty (build a new world from the config)
+    std::string m_SavePath;     // Default: empty (no save at the end)
+    std::string m_JournalPath;  // Default: empty (no journal)
+    std::string m_ReplayPath;   // Default: empty (normal run)
+    std::vector<SSweepAxis> m_SweepAxes;    // Default: empty (a sweep runs the base policy only)
+    int32_t m_SweepSeeds;       // Default: 0 (no sweep; otherwise seeds --seed, --seed + 1, ...)
+    std::string m_SweepPath;    // Default: empty (no sweep result file)
+
+    SHeadlessOptions()
+        : m_Config()
+        , m_Months(120)
+        , m_ReportInterval(12)
+        , m_PolicyPath()
+        , m_MicroFirms(0)
+        , m_Regions(1)
+        , m_LoadPath()
+        , m_SavePath()
+        , m_JournalPath()
+        , m_ReplayPath()
+        , m_SweepAxes()
+        , m_SweepSeeds(0)
+        , m_SweepPath()
+    {
+    }
+};
+
+// Split micro-firms over informal sector clusters in the proportions of
+// the design doc example (services 10, retail 8, industry 9, agriculture 5),
+// one set of clusters per leaf region
+void AddMicroFirmClusters(int64_t microFirms, int32_t regions, SEconomyConfig& config)
+{
+    struct SShare { ESector m_Sector; int64_t m_Parts; };
+    const SShare shares[] = {
+        { ESector::Services, 10 },
+        { ESector::Retail, 8 },
+        { ESector::Industry, 9 },
+        { ESector::Agriculture, 5 }
+    };
+
+    int64_t remaining = microFirms;
+    for (int32_t region = 0; region < regions; ++region)
+    {
+        for (size_t i = 0; i < sizeof(shares) / sizeof(shares[0]); ++i)
+        {
+            bool last = region + 1 == regions && i + 1 == sizeof(shares) / sizeof(shares[0]);
+            int64_t population = last ? remaining : microFirms * shares[i].m_Parts / 32 / regions;
+            remaining -= population;
+            config.m_Clusters.emplace_back(shares[i].m_Sector, ECompanySize::Micro, 0.3f, population, region);
+        }
+    }
+}
+
+void PrintUsage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --companies N     Companies created at startup (default 250)\n"
+              << "  --seed N          World seed (default " << CCounterRNG::DEFAULT_WORLD_SEED << ")\n"
+              << "  --months N        Months to simulate (default 120)\n"
+              << "  --policy FILE     Policy file (Key = Value per line)\n"
+              << "  --threads N       Worker threads, 0 = one per core (default 0)\n"
+              << "  --report N        Print aggregates every N months, 0 = only at the end (default 12)\n"
+              << "  --micro-firms N   Add N self-employed firms as aggregate clusters (default 0)\n"
+              << "  --represent N     Simulate --companies as a weighted sample of N companies (default 0 = off)\n"
+              << "  --lod N           Keep N full agents, re-tiering companies every 3 months (default 0 = off)\n"
+              << "  --regions N       Split the economy into N equal leaf regions (default 1)\n"
+              << "  --firm-dynamics N 1 = companies close and new ones enter each month, 0 = fixed set (default 1)\n"
+              << "  --load FILE       Continue a saved economy instead of building one (world options are ignored)\n"
+              << "  --save FILE       Save the economy after the last month\n"
+              << "  --journal FILE    Record policy changes and per-month state hashes of this run\n"
+              << "  --replay FILE     Re-run a recorded journal and check every state hash (other options ignored)\n"
+              << "  --sweep K=A,B,... Sweep policy field K (a --policy key) over the values; repeat for a grid\n"
+              << "  --seeds N         Run every swept policy on N seeds (turns on a sweep; default 1 with --sweep)\n"
+              << "  --sweep-out FILE  Write every run's macro series and the confidence bands to FILE\n";
+}
+
+// "TariffRate=0,10,25" -> field and values
+bool ParseSweepAxis(const char* text, SSweepAxis& axis)
+{
+    std::string definition = text;
+    size_t separator = definition.find('=');
+    std::string name = definition.substr(0, separator);
+
+    int32_t field = 0;
+    while (field < static_cast<int32_t>(EPolicyField::COUNT) &&
+           name != CPolicyJournal::GetFieldName(static_cast<EPolicyField>(field)))
+    {
+        ++field;
+    }
+    if (separator == std::string::npos || field == static_cast<int32_t>(EPolicyField::COUNT))
+    {
+        std::cerr << "--sweep expects Key=A,B,... with a policy key, got " << text << std::endl;
+        return false;
+    }
+    axis.m_Field = static_cast<EPolicyField>(field);
+
+    const char* cursor = definition.c_str() + separator + 1;
+    while (*cursor != '\0')
+    {
+        char* end = nullptr;
+        float value = std::strtof(cursor, &end);
+        if (end == cursor || (*end != ',' && *end != '\0'))
+        {
+            std::cerr << "--sweep " << name << ": bad value list" << std::endl;
+            return false;
+        }
+        axis.m_Values.push_back(value);
+        cursor = *end == ',' ? end + 1 : end;
+    }
+    return !axis.m_Values.empty();
+}
+
+bool ParseArguments(int argc, char* argv[], SHeadlessOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* argument = argv[i];
+        if (std::strcmp(argument, "--help") == 0 || std::strcmp(argument, "-h") == 0)
+        {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << argument << std::endl;
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (std::strcmp(argument, "--companies") == 0)
+            options.m_Config.m_CompanyCount = std::atoi(value);
+        else if (std::strcmp(argument, "--seed") == 0)
+            options.m_Config.m_WorldSeed = std::strtoull(value, nullptr, 0);
+        else if (std::strcmp(argument, "--months") == 0)
+            options.m_Months = std::atoi(value);
+        else if (std::strcmp(argument, "--policy") == 0)
+            options.m_PolicyPath = value;
+        else if (std::strcmp(argument, "--threads") == 0)
+            options.m_Config.m_WorkerThreads = static_cast<size_t>(std::strtoull(value, nullptr, 10));
+        else if (std::strcmp(argument, "--report") == 0)
+            options.m_ReportInterval = std::atoi(value);
+        else if (std::strcmp(argument, "--micro-firms") == 0)
+            options.m_MicroFirms = std::strtoll(value, nullptr, 10);
+        else if (std::strcmp(argument, "--represent") == 0)
+            options.m_Config.m_Sampling.m_RepresentedCompanies = std::strtoll(value, nullptr, 10);
+        else if (std::strcmp(argument, "--regions") == 0)
+            options.m_Regions = std::atoi(value);
+        else if (std::strcmp(argument, "--firm-dynamics") == 0)
+            options.m_Config.m_FirmDynamics.m_Enabled = std::atoi(value) != 0;
+        else if (std::strcmp(argument, "--load") == 0)
+            options.m_LoadPath = value;
+        else if (std::strcmp(argument, "--save") == 0)
+            options.m_SavePath = value;
+        else if (std::strcmp(argument, "--journal") == 0)
+            options.m_JournalPath = value;
+        else if (std::strcmp(argument, "--replay") == 0)
+            options.m_ReplayPath = value;
+        else if (std::strcmp(argument, "--seeds") == 0)
+            options.m_SweepSeeds = std::atoi(value);
+        else if (std::strcmp(argument, "--sweep-out") == 0)
+            options.m_SweepPath = value;
+        else if (std::strcmp(argument, "--sweep") == 0)
+        {
+            SSweepAxis axis;
+            if (!ParseSweepAxis(value, axis))
+            {
+                return false;
+            }
+            options.m_SweepAxes.push_back(axis);
+            options.m_SweepSeeds = std::max(options.m_SweepSeeds, 1);
+        }
+        else if (std::strcmp(argument, "--lod") == 0)
+        {
+            options.m_Config.m_LOD.m_FullAgentBudget = std::atoi(value);
+            options.m_Config.m_LOD.m_ReviewInterval = options.m_Config.m_LOD.m_FullAgentBudget > 0 ? 3 : 0;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << argument << std::endl;
+            return false;
+        }
+    }
+
+    if (options.m_Config.m_CompanyCount <= 0 || options.m_Months < 0 || options.m_MicroFirms < 0 ||
+        options.m_Regions <= 0 || options.m_Regions > CRegionMap::MAX_LEAVES || options.m_SweepSeeds < 0)
+    {
+        std::cerr << "--companies and --regions must be positive, --months, --micro-firms and --seeds non-negative" << std::endl;
+        return false;
+    }
+
+    // Full agents need a live company ID each; --represent only sets weights
+    const SSamplingConfig& sampling = options.m_Config.m_Sampling;
+    const int64_t maxCompanies = CCompanyIDAllocator::MAX_LIVE_IDS;
+    if (options.m_Config.m_CompanyCount > maxCompanies || options.m_Config.m_LOD.m_FullAgentBudget > maxCompanies ||
+        sampling.m_RepresentedCompanies < 0)
+    {
+        std::cerr << "--companies and --lod must be at most " << maxCompanies
+                  << " (company ID capacity), --represent non-negative" << std::endl;
+        return false;
+    }
+
+    if (options.m_Regions > 1)
+    {
+        for (int32_t region = 0; region < options.m_Regions; ++region)
+        {
+            options.m_Config.m_Regions.emplace_back("Region_" + std::to_string(region), -1, 1.0f);
+        }
+    }
+
+    if (options.m_MicroFirms > 0)
+    {
+        AddMicroFirmClusters(options.m_MicroFirms, options.m_Regions, options.m_Config);
+    }
+    return true;
+}
+
+void PrintAggregates(const CEconomyManager& economy)
+{
+    std::cout << "Month " << economy.GetTick()
+              << ": firms " << economy.GetRepresentedCompanyCount()
+              << ", GDP " << economy.GetTotalGDP()
+              << "K, employment " << economy.GetTotalEmployment()
+              << ", unemployment " << economy.GetUnemploymentRate()
+              << "%, avg profit " << economy.GetAverageProfitability()
+              << "K";
+    if (economy.GetFirmDynamics().IsEnabled())
+    {
+        const CFirmDynamics& dynamics = economy.GetFirmDynamics();
+        std::cout << ", +" << dynamics.GetLastEntries() << "/-" << dynamics.GetLastExits() << " firms";
+    }
+    std::cout << std::endl;
+}
+
+// Re-runs a recorded session on this machine, applying each policy change
+// before its month and comparing the state hash after every month.
+// Returns 0 when all hashes match and 2 at the first divergence.
+int RunReplay(const SHeadlessOptions& options)
+{
+    CPolicyJournal journal;
+    if (!journal.Load(options.m_ReplayPath))
+    {
+        return 1;
+    }
+
+    // The recording's world, with this run's thread count
+    SEconomyConfig config = journal.GetConfig();
+    config.m_WorkerThreads = options.m_Config.m_WorkerThreads;
+
+    CEconomyManager economy;
+    SPolicyParams policy = journal.GetInitialPolicy();
+    economy.SetPolicyParams(policy);
+    economy.Initialize(config);
+
+    // Only the ticks are timed, not the hashing
+    double seconds = 0.0;
+    size_t nextChange = 0;
+    for (uint32_t tick = 0; tick < journal.GetMonthCount(); ++tick)
+    {
+        nextChange = journal.ApplyChanges(tick, nextChange, policy);
+        economy.SetPolicyParams(policy);
+
+        auto start = std::chrono::steady_clock::now();
+        economy.AdvanceMonth();
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        uint64_t hash = economy.ComputeStateHash();
+        if (hash != journal.GetStateHash(tick + 1))
+        {
+            std::cerr << "Replay diverged at month " << tick + 1 << ": state hash " << std::hex << hash
+                      << ", recorded " << journal.GetStateHash(tick + 1) << std::dec << std::endl;
+            return 2;
+        }
+        if (options.m_ReportInterval > 0 && (tick + 1) % options.m_ReportInterval == 0)
+        {
+            PrintAggregates(economy);
+        }
+    }
+
+    PrintAggregates(economy);
+    std::cout << "Replayed " << journal.GetMonthCount() << " months and " << journal.GetChanges().size()
+              << " policy changes on " << economy.GetWorkerThreadCount() << " threads in " << seconds
+              << " s; every state hash matches" << std::endl;
+    return 0;
+}
+
+// Runs every policy of the --sweep grid on every seed and prints the
+// confidence band of GDP and unemployment in the last month per policy
+int RunSweep(const SHeadlessOptions& options, const SPolicyParams& basePolicy)
+{
+    // Cartesian product of the axes, the first axis varying slowest
+    std::vector<SPolicyParams> policies(1, basePolicy);
+    for (const SSweepAxis& axis : options.m_SweepAxes)
+    {
+        std::vector<SPolicyParams> grid;
+        for (const SPolicyParams& policy : policies)
+        {
+            for (float value : axis.m_Values)
+            {
+                grid.push_back(policy);
+                CPolicyJournal::SetField(grid.back(), axis.m_Field, value);
+            }
+        }
+        policies.swap(grid);
+    }
+
+    std::vector<uint64_t> seeds;
+    for (int32_t seed = 0; seed < options.m_SweepSeeds; ++seed)
+    {
+        seeds.push_back(options.m_Config.m_WorldSeed + static_cast<uint64_t>(seed));
+    }
+
+    CPolicySweep sweep;
+    sweep.Configure(options.m_Config, policies, seeds, options.m_Months);
+
+    // Every run initializes or forks a world; silence their logging
+    auto start = std::chrono::steady_clock::now();
+    std::cout.setstate(std::ios::failbit);
+    bool written = sweep.Run(options.m_Config.m_WorkerThreads, options.m_SweepPath);
+    std::cout.clear();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t last = static_cast<size_t>(std::max(options.m_Months, 1) - 1);
+    for (size_t policy = 0; policy < sweep.GetPolicyCount() && options.m_Months > 0; ++policy)
+    {
+        std::cout << "Policy " << policy << ":";
+        for (const SSweepAxis& axis : options.m_SweepAxes)
+        {
+            std::cout << " " << CPolicyJournal::GetFieldName(axis.m_Field) << "="
+                      << CPolicyJournal::GetField(sweep.GetPolicy(policy), axis.m_Field);
+        }
+
+        const SSweepBand& gdp = sweep.GetBand(policy, EProjectionMetric::GDP);
+        const SSweepBand& unemployment = sweep.GetBand(policy, EProjectionMetric::UnemploymentRate);
+        std::cout << " | GDP " << gdp.m_Mean[last] << "K [" << gdp.m_Low[last] << ", " << gdp.m_High[last]
+                  << "], unemployment " << unemployment.m_Mean[last] << "% [" << unemployment.m_Low[last]
+                  << ", " << unemployment.m_High[last] << "]" << std::endl;
+    }
+
+    size_t runs = sweep.GetPolicyCount() * sweep.GetSeedCount();
+    std::cout << "Swept " << sweep.GetPolicyCount() << " policies x " << sweep.GetSeedCount() << " seeds ("
+              << runs << " runs of " << options.m_Months << " months) in " << seconds << " s ("
+              << (seconds > 0.0 ? runs / seconds : 0.0) << " runs/s); bands are "
+              << CPolicySweep::CONFIDENCE_Z << " standard errors of the mean" << std::endl;
+    return written ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SHeadlessOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!options.m_ReplayPath.empty())
+    {
+        return RunReplay(options);
+    }
+
+    if (options.m_SweepSeeds > 0)
+    {
+        SPolicyParams policy;
+        if (!options.m_PolicyPath.empty() && !CPolicyFile::Load(options.m_PolicyPath, policy))
+        {
+            return 1;
+        }
+        return RunSweep(options, policy);
+    }
+
+    CEconomyManager economy;
+    if (!options.m_LoadPath.empty())
+    {
+        // The save carries its own world and policy; --policy still overrides it
+        economy.SetWorkerThreadCount(options.m_Config.m_WorkerThreads);
+        if (!economy.LoadState(options.m_LoadPath))
+        {
+            return 1;
+        }
+    }
+
+    if (!options.m_PolicyPath.empty())
+    {
+        SPolicyParams policy = economy.GetPolicyParams();
+        if (!CPolicyFile::Load(options.m_PolicyPath, policy))
+        {
+            return 1;
+        }
+        economy.SetPolicyParams(policy);
+    }
+
+    if (options.m_LoadPath.empty())
+    {
+        economy.Initialize(options.m_Config);
+    }
+
+    if (!options.m_JournalPath.empty() && !economy.StartJournal())
+    {
+        return 1;
+    }
+
+    // Ticks run back to back; there is no frame pacing or time scale here.
+    // Rows come and go with firm dynamics and LOD, so each month counts the
+    // rows it starts with.
+    double companyMonths = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t month = 1; month <= options.m_Months; ++month)
+    {
+        companyMonths += static_cast<double>(economy.GetCompanyCount());
+        economy.AdvanceMonth();
+        if (options.m_ReportInterval > 0 && month % options.m_ReportInterval == 0)
+        {
+            PrintAggregates(economy);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double averageCompanies = options.m_Months > 0 ? companyMonths / options.m_Months
+                                                   : static_cast<double>(economy.GetCompanyCount());
+
+    PrintAggregates(economy);
+    for (const CCompanyCluster& cluster : economy.GetClusters())
+    {
+        std::cout << "Cluster " << cluster.GetID() << " (sector " << static_cast<int32_t>(cluster.GetSector())
+                  << "): " << cluster.GetPopulation() << " firms, " << cluster.GetEmployees().m_Mean
+                  << " employees/firm, profit " << cluster.GetProfitability().m_Mean
+                  << "K +- " << std::sqrt(cluster.GetProfitability().m_Variance)
+                  << ", formality " << cluster.GetFormality().m_Mean << std::endl;
+    }
+    if (economy.GetLOD().IsEnabled())
+    {
+        const CLODManager& lod = economy.GetLOD();
+        std::cout << "LOD: " << lod.GetFullAgentCount() << " of " << lod.GetFullAgentBudget()
+                  << " full agents, last review +"
+                  << lod.GetLastPromotions() << " promoted, -" << lod.GetLastDemotions() << " demoted" << std::endl;
+    }
+    if (!options.m_SavePath.empty() && !economy.SaveState(options.m_SavePath))
+    {
+        return 1;
+    }
+    if (!options.m_JournalPath.empty() && !economy.GetJournal().Save(options.m_JournalPath))
+    {
+        return 1;
+    }
+
+    std::cout << "Simulated " << options.m_Months << " months of " << std::llround(averageCompanies)
+              << " companies (monthly average) on " << economy.GetWorkerThreadCount() << " threads in " << seconds << " s ("
+              << (seconds > 0.0 ? options.m_Months / seconds : 0.0) << " months/s, "
+              << (companyMonths > 0.0 ? seconds * 1.0e9 / companyMonths : 0.0) << " ns/company-month)" << std::endl;
+
+    return 0;
+}
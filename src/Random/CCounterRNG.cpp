@@ -0,0 +1,131 @@
+#include "Random/CCounterRNG.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POLITICSIM_RNG_SSE2 1
+#endif
+
+namespace PoliticSim {
+
+namespace {
+
+#if defined(__AVX2__)
+// 32x32 -> 64 multiply of every lane by a broadcast constant, split into halves
+inline void MulHiLoAVX2(__m256i a, __m256i m, __m256i& hi, __m256i& lo)
+{
+    __m256i even = _mm256_mul_epu32(a, m);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    lo = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                               _mm256_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    hi = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)),
+                               _mm256_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+size_t Next32BatchAVX2(uint64_t worldSeed, const uint32_t* entities, size_t count,
+                       uint32_t tick, ERandomStream stream, uint32_t* out, uint32_t index, size_t begin)
+{
+    const __m256i m0 = _mm256_set1_epi32(static_cast<int32_t>(CCounterRNG::PHILOX_M0));
+    const __m256i m1 = _mm256_set1_epi32(static_cast<int32_t>(CCounterRNG::PHILOX_M1));
+
+    size_t i = begin;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i c0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(entities + i));
+        __m256i c1 = _mm256_set1_epi32(static_cast<int32_t>(tick));
+        __m256i c2 = _mm256_set1_epi32(static_cast<int32_t>(stream));
+        __m256i c3 = _mm256_set1_epi32(static_cast<int32_t>(index));
+        uint32_t k0 = static_cast<uint32_t>(worldSeed);
+        uint32_t k1 = static_cast<uint32_t>(worldSeed >> 32);
+
+        for (int32_t round = 0; round < CCounterRNG::PHILOX_ROUNDS; ++round)
+        {
+            __m256i hi0, lo0, hi1, lo1;
+            MulHiLoAVX2(c0, m0, hi0, lo0);
+            MulHiLoAVX2(c2, m1, hi1, lo1);
+
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32(static_cast<int32_t>(k0)));
+            c1 = lo1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32(static_cast<int32_t>(k1)));
+            c3 = lo0;
+
+            k0 += CCounterRNG::PHILOX_W0;
+            k1 += CCounterRNG::PHILOX_W1;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), c0);
+    }
+    return i;
+}
+#endif
+
+#if defined(POLITICSIM_RNG_SSE2)
+inline void MulHiLoSSE2(__m128i a, __m128i m, __m128i& hi, __m128i& lo)
+{
+    __m128i even = _mm_mul_epu32(a, m);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+size_t Next32BatchSSE2(uint64_t worldSeed, const uint32_t* entities, size_t count,
+                       uint32_t tick, ERandomStream stream, uint32_t* out, uint32_t index, size_t begin)
+{
+    const __m128i m0 = _mm_set1_epi32(static_cast<int32_t>(CCounterRNG::PHILOX_M0));
+    const __m128i m1 = _mm_set1_epi32(static_cast<int32_t>(CCounterRNG::PHILOX_M1));
+
+    size_t i = begin;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entities + i));
+        __m128i c1 = _mm_set1_epi32(static_cast<int32_t>(tick));
+        __m128i c2 = _mm_set1_epi32(static_cast<int32_t>(stream));
+        __m128i c3 = _mm_set1_epi32(static_cast<int32_t>(index));
+        uint32_t k0 = static_cast<uint32_t>(worldSeed);
+        uint32_t k1 = static_cast<uint32_t>(worldSeed >> 32);
+
+        for (int32_t round = 0; round < CCounterRNG::PHILOX_ROUNDS; ++round)
+        {
+            __m128i hi0, lo0, hi1, lo1;
+            MulHiLoSSE2(c0, m0, hi0, lo0);
+            MulHiLoSSE2(c2, m1, hi1, lo1);
+
+            c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), _mm_set1_epi32(static_cast<int32_t>(k0)));
+            c1 = lo1;
+            c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), _mm_set1_epi32(static_cast<int32_t>(k1)));
+            c3 = lo0;
+
+            k0 += CCounterRNG::PHILOX_W0;
+            k1 += CCounterRNG::PHILOX_W1;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), c0);
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+void CCounterRNG::Next32Batch(uint64_t worldSeed, const uint32_t* entities, size_t count,
+                              uint32_t tick, ERandomStream stream, uint32_t* out, uint32_t index)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    i = Next32BatchAVX2(worldSeed, entities, count, tick, stream, out, index, i);
+#endif
+#if defined(POLITICSIM_RNG_SSE2)
+    i = Next32BatchSSE2(worldSeed, entities, count, tick, stream, out, index, i);
+#endif
+    for (; i < count; ++i)
+    {
+        out[i] = Next32(worldSeed, entities[i], tick, stream, index);
+    }
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,105 @@
+#include "Save/CConfigChunks.h"
+#include "Save/CSaveReader.h"
+#include "Save/CSaveWriter.h"
+
+namespace PoliticSim {
+
+void CConfigChunks::WriteConfig(CSaveWriter& writer, const SEconomyConfig& config)
+{
+    writer.Write(config.m_WorldSeed);
+    writer.Write(config.m_CompanyCount);
+    writer.Write(config.m_ExpectationMonths);
+    writer.Write(config.m_History.m_Depth);
+    writer.Write(config.m_History.m_MetricMask);
+    writer.Write(config.m_History.m_Precision);
+    writer.Write(config.m_Sampling.m_RepresentedCompanies);
+    writer.Write(config.m_Sampling.m_MinimumPerStratum);
+    writer.Write(config.m_LOD);
+    writer.Write(config.m_FirmDynamics.m_Enabled);
+    writer.Write(config.m_FirmDynamics.m_CompactionInterval);
+
+    writer.Write(static_cast<uint32_t>(config.m_Regions.size()));
+    for (const SRegionConfig& region : config.m_Regions)
+    {
+        writer.WriteString(region.m_Name);
+        writer.Write(region.m_Parent);
+        writer.Write(region.m_CompanyShare);
+    }
+
+    writer.Write(static_cast<uint32_t>(config.m_Clusters.size()));
+    for (const SClusterConfig& cluster : config.m_Clusters)
+    {
+        writer.Write(cluster.m_Sector);
+        writer.Write(cluster.m_Size);
+        writer.Write(cluster.m_FormalityLevel);
+        writer.Write(cluster.m_Population);
+        writer.Write(cluster.m_Region);
+    }
+}
+
+void CConfigChunks::ReadConfig(CSaveReader& reader, SEconomyConfig& config)
+{
+    reader.Read(config.m_WorldSeed);
+    reader.Read(config.m_CompanyCount);
+    reader.Read(config.m_ExpectationMonths);
+    reader.Read(config.m_History.m_Depth);
+    reader.Read(config.m_History.m_MetricMask);
+    reader.Read(config.m_History.m_Precision);
+    reader.Read(config.m_Sampling.m_RepresentedCompanies);
+    reader.Read(config.m_Sampling.m_MinimumPerStratum);
+    reader.Read(config.m_LOD);
+    reader.Read(config.m_FirmDynamics.m_Enabled);
+    reader.Read(config.m_FirmDynamics.m_CompactionInterval);
+
+    config.m_Regions.clear();
+    uint32_t regionCount = reader.Read<uint32_t>();
+    for (uint32_t i = 0; i < regionCount && reader.IsGood(); ++i)
+    {
+        SRegionConfig region;
+        region.m_Name = reader.ReadString();
+        reader.Read(region.m_Parent);
+        reader.Read(region.m_CompanyShare);
+        config.m_Regions.push_back(region);
+    }
+
+    config.m_Clusters.clear();
+    uint32_t clusterCount = reader.Read<uint32_t>();
+    for (uint32_t i = 0; i < clusterCount && reader.IsGood(); ++i)
+    {
+        SClusterConfig cluster;
+        reader.Read(cluster.m_Sector);
+        reader.Read(cluster.m_Size);
+        reader.Read(cluster.m_FormalityLevel);
+        reader.Read(cluster.m_Population);
+        reader.Read(cluster.m_Region);
+        config.m_Clusters.push_back(cluster);
+    }
+}
+
+void CConfigChunks::WritePolicy(CSaveWriter& writer, const SPolicyParams& policy)
+{
+    writer.Write(policy.m_CorporateTaxRate);
+    writer.Write(policy.m_LaborTaxRate);
+    writer.Write(policy.m_MinimumWage);
+    writer.Write(policy.m_LaborRegulationBurden);
+    writer.Write(policy.m_EnvironmentalComplianceCost);
+    writer.Write(policy.m_StrictEnvironmentalPolicy);
+    writer.Write(policy.m_SubsidyRate);
+    writer.Write(policy.m_SubsidiesEnabled);
+    writer.Write(policy.m_TariffRate);
+}
+
+void CConfigChunks::ReadPolicy(CSaveReader& reader, SPolicyParams& policy)
+{
+    reader.Read(policy.m_CorporateTaxRate);
+    reader.Read(policy.m_LaborTaxRate);
+    reader.Read(policy.m_MinimumWage);
+    reader.Read(policy.m_LaborRegulationBurden);
+    reader.Read(policy.m_EnvironmentalComplianceCost);
+    reader.Read(policy.m_StrictEnvironmentalPolicy);
+    reader.Read(policy.m_SubsidyRate);
+    reader.Read(policy.m_SubsidiesEnabled);
+    reader.Read(policy.m_TariffRate);
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,221 @@
+#include "Save/CSaveReader.h"
+#include <fstream>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POLITICSIM_HAS_MMAP 1
+#endif
+
+namespace PoliticSim {
+
+CSaveReader::CSaveReader()
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_Offset(0)
+    , m_PayloadBegin(0)
+    , m_PayloadEnd(0)
+    , m_Cursor(0)
+    , m_InChunk(false)
+    , m_Good(false)
+    , m_Path()
+    , m_Mapping(nullptr)
+    , m_MappingSize(0)
+    , m_Buffer()
+{
+}
+
+CSaveReader::~CSaveReader()
+{
+    Close();
+}
+
+bool CSaveReader::Open(const std::string& path)
+{
+    Close();
+    m_Path = path;
+
+    if (!MapFile(path))
+    {
+        std::cerr << "Save file: cannot open " << path << std::endl;
+        return false;
+    }
+    m_Good = true;
+
+    // Header (see CSaveWriter::Open)
+    if (m_Size < SSaveFormat::CHUNK_ALIGNMENT || std::memcmp(m_Data, SSaveFormat::MAGIC, sizeof(SSaveFormat::MAGIC)) != 0)
+    {
+        Fail("not an economy save");
+        return false;
+    }
+
+    uint32_t version;
+    uint32_t endianCheck;
+    std::memcpy(&version, m_Data + sizeof(SSaveFormat::MAGIC), sizeof(version));
+    std::memcpy(&endianCheck, m_Data + sizeof(SSaveFormat::MAGIC) + sizeof(version), sizeof(endianCheck));
+
+    if (endianCheck != SSaveFormat::ENDIAN_CHECK)
+    {
+        Fail("byte order does not match this host");
+        return false;
+    }
+    if (version != SSaveFormat::FORMAT_VERSION)
+    {
+        Fail("format version " + std::to_string(version) + ", expected " +
+             std::to_string(SSaveFormat::FORMAT_VERSION));
+        return false;
+    }
+
+    m_Offset = SSaveFormat::CHUNK_ALIGNMENT;
+    return true;
+}
+
+void CSaveReader::Close()
+{
+#ifdef POLITICSIM_HAS_MMAP
+    if (m_Mapping != nullptr)
+    {
+        munmap(m_Mapping, m_MappingSize);
+    }
+#endif
+    m_Mapping = nullptr;
+    m_MappingSize = 0;
+    m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Offset = 0;
+    m_InChunk = false;
+    m_Good = false;
+}
+
+bool CSaveReader::MapFile(const std::string& path)
+{
+#ifdef POLITICSIM_HAS_MMAP
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor >= 0)
+    {
+        struct stat status;
+        bool mapped = false;
+        if (fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            void* mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping != MAP_FAILED)
+            {
+                m_Mapping = mapping;
+                m_MappingSize = static_cast<size_t>(status.st_size);
+                m_Data = static_cast<const uint8_t*>(mapping);
+                m_Size = m_MappingSize;
+                mapped = true;
+            }
+        }
+        close(descriptor);
+        if (mapped)
+        {
+            return true;
+        }
+    }
+#endif
+
+    // Fallback: one read into a buffer (same layout, same pointers)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+    std::streamsize size = file.tellg();
+    if (size <= 0)
+    {
+        return false;
+    }
+    file.seekg(0);
+    m_Buffer.resize(static_cast<size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(m_Buffer.data()), size))
+    {
+        return false;
+    }
+    m_Data = m_Buffer.data();
+    m_Size = m_Buffer.size();
+    return true;
+}
+
+bool CSaveReader::BeginChunk(uint32_t tag)
+{
+    if (!m_Good)
+    {
+        return false;
+    }
+    if (m_InChunk || m_Offset + SSaveFormat::CHUNK_ALIGNMENT > m_Size)
+    {
+        Fail("truncated");
+        return false;
+    }
+
+    SSaveChunkHeader header;
+    std::memcpy(&header, m_Data + m_Offset, sizeof(header));
+    if (header.m_Tag != tag)
+    {
+        Fail("unexpected chunk at offset " + std::to_string(m_Offset));
+        return false;
+    }
+
+    m_PayloadBegin = m_Offset + SSaveFormat::CHUNK_ALIGNMENT;
+    if (header.m_PayloadSize > m_Size - m_PayloadBegin)
+    {
+        Fail("truncated");
+        return false;
+    }
+    m_PayloadEnd = m_PayloadBegin + static_cast<size_t>(header.m_PayloadSize);
+    m_Cursor = m_PayloadBegin;
+    m_InChunk = true;
+    return true;
+}
+
+void CSaveReader::EndChunk()
+{
+    // Unread payload is skipped
+    if (m_InChunk)
+    {
+        m_Offset = SSaveFormat::AlignUp(m_PayloadEnd);
+        m_InChunk = false;
+    }
+}
+
+std::string CSaveReader::ReadString()
+{
+    uint32_t length = Read<uint32_t>();
+    const uint8_t* bytes = ReadBytes(length);
+    return bytes != nullptr ? std::string(reinterpret_cast<const char*>(bytes), length) : std::string();
+}
+
+const uint8_t* CSaveReader::ReadBytes(size_t size)
+{
+    if (!m_Good)
+    {
+        return nullptr;
+    }
+    if (!m_InChunk || size > m_PayloadEnd - m_Cursor)
+    {
+        Fail("chunk shorter than expected");
+        return nullptr;
+    }
+
+    const uint8_t* bytes = m_Data + m_Cursor;
+    m_Cursor += size;
+    return bytes;
+}
+
+void CSaveReader::Fail(const std::string& message)
+{
+    if (m_Good || m_Data == nullptr)
+    {
+        std::cerr << "Save file " << m_Path << ": " << message << std::endl;
+    }
+    m_Good = false;
+}
+
+} // namespace PoliticSim
@@ -0,0 +1,132 @@
+#include "Save/CSaveWriter.h"
+#include <bit>
+#include <iostream>
+
+namespace PoliticSim {
+
+CSaveWriter::CSaveWriter()
+    : m_File()
+    , m_Path()
+    , m_Offset(0)
+    , m_ChunkStart(0)
+    , m_InChunk(false)
+    , m_Good(false)
+{
+}
+
+bool CSaveWriter::Open(const std::string& path)
+{
+    m_Path = path;
+    m_Offset = 0;
+    m_InChunk = false;
+    m_Good = false;
+
+    // Values are written as their in-memory bytes
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        std::cerr << "Save file " << path << ": big-endian hosts are not supported" << std::endl;
+        return false;
+    }
+
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File)
+    {
+        std::cerr << "Save file: cannot create " << path << std::endl;
+        return false;
+    }
+    m_Good = true;
+
+    // File header: magic, version, byte order check, padded to one chunk slot
+    WriteBytes(SSaveFormat::MAGIC, sizeof(SSaveFormat::MAGIC));
+    Write(SSaveFormat::FORMAT_VERSION);
+    Write(SSaveFormat::ENDIAN_CHECK);
+    Pad(SSaveFormat::AlignUp(m_Offset));
+    return m_Good;
+}
+
+bool CSaveWriter::Close()
+{
+    if (m_InChunk)
+    {
+        std::cerr << "Save file " << m_Path << ": closed inside a chunk" << std::endl;
+        m_Good = false;
+    }
+
+    if (m_File.is_open())
+    {
+        m_File.close();
+        if (m_File.fail())
+        {
+            m_Good = false;
+        }
+    }
+
+    if (!m_Good)
+    {
+        std::cerr << "Save file " << m_Path << ": write failed" << std::endl;
+    }
+    return m_Good;
+}
+
+void CSaveWriter::BeginChunk(uint32_t tag)
+{
+    if (m_InChunk)
+    {
+        m_Good = false;
+        return;
+    }
+
+    // Header placeholder, patched with the payload size by EndChunk
+    m_ChunkStart = m_Offset;
+    m_InChunk = true;
+    SSaveChunkHeader header = { tag, 0, 0 };
+    Write(header);
+    Pad(m_ChunkStart + SSaveFormat::CHUNK_ALIGNMENT);
+}
+
+void CSaveWriter::EndChunk()
+{
+    if (!m_InChunk)
+    {
+        m_Good = false;
+        return;
+    }
+
+    uint64_t payloadSize = m_Offset - m_ChunkStart - SSaveFormat::CHUNK_ALIGNMENT;
+    m_File.seekp(static_cast<std::streamoff>(m_ChunkStart + sizeof(uint32_t) * 2));
+    m_File.write(reinterpret_cast<const char*>(&payloadSize), sizeof(payloadSize));
+    m_File.seekp(static_cast<std::streamoff>(m_Offset));
+    m_InChunk = false;
+
+    Pad(SSaveFormat::AlignUp(m_Offset));
+    m_Good = m_Good && m_File.good();
+}
+
+void CSaveWriter::WriteString(const std::string& text)
+{
+    Write(static_cast<uint32_t>(text.size()));
+    WriteBytes(text.data(), text.size());
+}
+
+void CSaveWriter::WriteBytes(const void* data, size_t size)
+{
+    if (!m_Good || size == 0)
+    {
+        return;
+    }
+
+    m_File.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    m_Offset += size;
+    m_Good = m_File.good();
+}
+
+void CSaveWriter::Pad(uint64_t offset)
+{
+    static const char zeros[SSaveFormat::CHUNK_ALIGNMENT] = {};
+    if (offset > m_Offset)
+    {
+        WriteBytes(zeros, static_cast<size_t>(offset - m_Offset));
+    }
+}
+
+} // namespace PoliticSim
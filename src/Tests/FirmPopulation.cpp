@@ -0,0 +1,85 @@
+// Checks that entry replaces exit in a neutral market: the default economy,
+// and a larger one with micro-firm clusters over several regions, keep their
+// firm populations within the tolerance of the start over 120 months.
+// Exits non-zero when a population drifts outside it.
+#include "Economy/CEconomyManager.h"
+#include "Economy/SEconomyConfig.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using namespace PoliticSim;
+
+namespace {
+
+constexpr int32_t MONTHS = 120;
+constexpr double TOLERANCE = 0.05;
+
+double GetClusterFirms(const CEconomyManager& economy)
+{
+    double firms = 0.0;
+    for (const CCompanyCluster& cluster : economy.GetClusters())
+    {
+        firms += static_cast<double>(cluster.GetPopulation());
+    }
+    return firms;
+}
+
+// Returns the number of months some population was out of tolerance
+int32_t RunEconomy(const char* name, const SEconomyConfig& config)
+{
+    CEconomyManager economy(1);
+    economy.Initialize(config);
+
+    double startClusters = GetClusterFirms(economy);
+    double startCompanies = economy.GetRepresentedCompanyCount() - startClusters;
+    double endCompanies = startCompanies;
+    double endClusters = startClusters;
+    int32_t failures = 0;
+    for (int32_t month = 1; month <= MONTHS; ++month)
+    {
+        economy.AdvanceMonth();
+        endClusters = GetClusterFirms(economy);
+        endCompanies = economy.GetRepresentedCompanyCount() - endClusters;
+
+        bool companiesHeld = std::abs(endCompanies - startCompanies) <= startCompanies * TOLERANCE;
+        bool clustersHeld = std::abs(endClusters - startClusters) <= startClusters * TOLERANCE;
+        if (!companiesHeld || !clustersHeld)
+        {
+            if (failures == 0)
+            {
+                std::printf("%s: month %d: companies %.0f (start %.0f), cluster firms %.0f (start %.0f)\n",
+                            name, month, endCompanies, startCompanies, endClusters, startClusters);
+            }
+            failures++;
+        }
+    }
+
+    std::printf("%s: companies %.0f -> %.0f, cluster firms %.0f -> %.0f over %d months\n",
+                name, startCompanies, endCompanies, startClusters, endClusters, MONTHS);
+    return failures;
+}
+
+} // namespace
+
+int main()
+{
+    int32_t failures = RunEconomy("default", SEconomyConfig());
+
+    // Three regions, each with one informal cluster per sector
+    SEconomyConfig clustered;
+    clustered.m_CompanyCount = 20000;
+    for (int32_t region = 0; region < 3; ++region)
+    {
+        clustered.m_Regions.emplace_back("Region_" + std::to_string(region), -1, 1.0f);
+        for (ESector sector : { ESector::Services, ESector::Retail, ESector::Industry, ESector::Agriculture })
+        {
+            clustered.m_Clusters.emplace_back(sector, ECompanySize::Micro, 0.3f, 100000, region);
+        }
+    }
+    failures += RunEconomy("clustered", clustered);
+
+    std::printf("%d months out of the %.0f%% tolerance\n", failures, TOLERANCE * 100.0);
+    return failures == 0 ? 0 : 1;
+}
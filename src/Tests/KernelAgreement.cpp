@@ -0,0 +1,191 @@
+// Checks the vector company kernels against the scalar reference on random
+// batches. Batch lengths cover every tail that does not fill a vector
+// register (up to 16 lanes), and batches start at unaligned offsets.
+// Exits non-zero on any result outside the tolerance.
+#include "Economy/CCompanyKernels.h"
+#include "Economy/CSamplingStrategy.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace PoliticSim;
+
+namespace {
+
+// Relative, with an absolute floor for results near zero
+constexpr float TOLERANCE = 1e-5f;
+
+int32_t RandomStratum(std::mt19937& rng)
+{
+    return static_cast<int32_t>(rng() % static_cast<uint32_t>(CSamplingStrategy::STRATUM_COUNT));
+}
+
+// Owns the columns of one batch
+struct SBatchColumns
+{
+    std::vector<int32_t> m_Employees;
+    std::vector<float> m_BaseProductivity;
+    std::vector<float> m_CapacityUtilization;
+    std::vector<float> m_DomesticOrientation;
+    std::vector<float> m_WageLevel;
+    std::vector<float> m_LaborIntensity;
+    std::vector<float> m_Debt;
+    std::vector<ESector> m_Sectors;
+    std::vector<ECompanySize> m_Sizes;
+
+    // 'bucket' >= 0 gives every company that sector x size stratum
+    void Fill(std::mt19937& rng, size_t count, int32_t bucket)
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        m_Employees.resize(count);
+        m_BaseProductivity.resize(count);
+        m_CapacityUtilization.resize(count);
+        m_DomesticOrientation.resize(count);
+        m_WageLevel.resize(count);
+        m_LaborIntensity.resize(count);
+        m_Debt.resize(count);
+        m_Sectors.resize(count);
+        m_Sizes.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_Employees[i] = 1 + static_cast<int32_t>(rng() % 2000);
+            m_BaseProductivity[i] = 0.5f + unit(rng) * 1.5f;
+            m_CapacityUtilization[i] = 0.3f + unit(rng) * 0.7f;
+            m_DomesticOrientation[i] = unit(rng);
+            m_WageLevel[i] = 1.0f + unit(rng) * 6.0f;
+            m_LaborIntensity[i] = 0.2f + unit(rng) * 0.6f;
+            m_Debt[i] = unit(rng) * 5000.0f;
+            int32_t stratum = bucket >= 0 ? bucket : RandomStratum(rng);
+            m_Sectors[i] = CSamplingStrategy::GetStratumSector(stratum);
+            m_Sizes[i] = CSamplingStrategy::GetStratumSize(stratum);
+        }
+    }
+
+    SFinancialBatch MakeBatch(size_t offset, size_t count, float* revenue, float* profitability) const
+    {
+        SFinancialBatch batch;
+        batch.m_Count = count;
+        batch.m_Employees = m_Employees.data() + offset;
+        batch.m_BaseProductivity = m_BaseProductivity.data() + offset;
+        batch.m_CapacityUtilization = m_CapacityUtilization.data() + offset;
+        batch.m_DomesticOrientation = m_DomesticOrientation.data() + offset;
+        batch.m_WageLevel = m_WageLevel.data() + offset;
+        batch.m_LaborIntensity = m_LaborIntensity.data() + offset;
+        batch.m_Debt = m_Debt.data() + offset;
+        batch.m_Sectors = m_Sectors.data() + offset;
+        batch.m_Sizes = m_Sizes.data() + offset;
+        batch.m_Revenue = revenue;
+        batch.m_Profitability = profitability;
+        return batch;
+    }
+};
+
+SFinancialCoefficients MakeCoefficients(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    SPolicyParams policy;
+    policy.m_LaborTaxRate = unit(rng) * 40.0f;
+    policy.m_CorporateTaxRate = unit(rng) * 40.0f;
+    policy.m_TariffRate = unit(rng) * 30.0f;
+    policy.m_SubsidiesEnabled = unit(rng) < 0.5f;
+    policy.m_StrictEnvironmentalPolicy = unit(rng) < 0.5f;
+
+    SMacroState macro;
+    macro.m_AggregateDemand = 0.5f + unit(rng);
+    macro.m_BusinessConfidence = unit(rng) * 100.0f;
+    macro.m_InterestRate = unit(rng) * 15.0f;
+    for (int32_t sector = 0; sector < static_cast<int32_t>(ESector::COUNT); ++sector)
+    {
+        macro.m_SectorSaturation[sector] = unit(rng);
+        macro.m_ImportCompetition[sector] = unit(rng) * 0.5f;
+    }
+    return CCompanyKernels::BuildCoefficients(policy, macro);
+}
+
+bool Agrees(float expected, float actual)
+{
+    return std::abs(expected - actual) <= TOLERANCE * std::max(1.0f, std::abs(expected));
+}
+
+// Compares one kernel's output with the reference; prints the first mismatch
+int32_t Compare(const char* kernel, const std::vector<float>& expected, const std::vector<float>& actual,
+                const char* column, size_t count)
+{
+    int32_t mismatches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!Agrees(expected[i], actual[i]))
+        {
+            if (mismatches == 0)
+            {
+                std::printf("%s: %s[%zu] of %zu is %.9g, reference %.9g\n",
+                            kernel, column, i, count, actual[i], expected[i]);
+            }
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main()
+{
+    constexpr int32_t ROUNDS = 200;
+    constexpr size_t MAX_OFFSET = 3;
+
+    std::mt19937 rng(20240501u);
+    std::vector<size_t> lengths;
+    for (size_t count = 0; count <= 40; ++count)
+    {
+        lengths.push_back(count);
+    }
+    lengths.push_back(255);
+    lengths.push_back(256);
+    lengths.push_back(1021);
+
+    int32_t mismatches = 0;
+    int32_t batches = 0;
+    SBatchColumns columns;
+    for (int32_t round = 0; round < ROUNDS; ++round)
+    {
+        SFinancialCoefficients coefficients = MakeCoefficients(rng);
+        for (size_t count : lengths)
+        {
+            // Mixed batches for ComputeFinancials, one bucket for ComputeFinancialsBucket
+            for (int32_t mode = 0; mode < 2; ++mode)
+            {
+                size_t offset = rng() % (MAX_OFFSET + 1);
+                int32_t bucket = mode == 0 ? -1 : RandomStratum(rng);
+                columns.Fill(rng, offset + count, bucket);
+
+                std::vector<float> referenceRevenue(count), referenceProfit(count);
+                std::vector<float> revenue(count), profit(count);
+                CCompanyKernels::ComputeFinancialsScalar(
+                    columns.MakeBatch(offset, count, referenceRevenue.data(), referenceProfit.data()), coefficients);
+
+                const char* kernel = mode == 0 ? "ComputeFinancials" : "ComputeFinancialsBucket";
+                SFinancialBatch batch = columns.MakeBatch(offset, count, revenue.data(), profit.data());
+                if (mode == 0)
+                {
+                    CCompanyKernels::ComputeFinancials(batch, coefficients);
+                }
+                else
+                {
+                    CCompanyKernels::ComputeFinancialsBucket(batch, coefficients);
+                }
+
+                mismatches += Compare(kernel, referenceRevenue, revenue, "revenue", count);
+                mismatches += Compare(kernel, referenceProfit, profit, "profitability", count);
+                batches++;
+            }
+        }
+    }
+
+    std::printf("%s kernels: %d batches, %d mismatches\n", CCompanyKernels::GetInstructionSetName(), batches, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#include "Threading/CWorkerPool.h"
+#include <algorithm>
+
+namespace PoliticSim {
+
+CWorkerPool::CWorkerPool(size_t threadCount)
+    : m_Task(nullptr)
+    , m_Count(0)
+    , m_GrainSize(1)
+    , m_ChunkCount(0)
+    , m_NextChunk(0)
+    , m_ActiveWorkers(0)
+    , m_JobGeneration(0)
+    , m_Stopping(false)
+{
+    size_t workerCount = std::max<size_t>(threadCount, 1) - 1;
+    m_Workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_Workers.emplace_back(&CWorkerPool::WorkerLoop, this);
+    }
+}
+
+CWorkerPool::~CWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_WorkAvailable.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+void CWorkerPool::ParallelFor(size_t count, size_t grainSize, const RangeTask& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    grainSize = std::max<size_t>(grainSize, 1);
+    size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    // Nothing to share: run inline without waking the workers
+    if (m_Workers.empty() || chunkCount == 1)
+    {
+        for (size_t begin = 0; begin < count; begin += grainSize)
+        {
+            task(begin, std::min(count, begin + grainSize));
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Task = &task;
+        m_Count = count;
+        m_GrainSize = grainSize;
+        m_ChunkCount = chunkCount;
+        m_NextChunk.store(0, std::memory_order_relaxed);
+        m_ActiveWorkers = m_Workers.size();
+        m_JobGeneration++;
+    }
+    m_WorkAvailable.notify_all();
+
+    RunChunks();
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_WorkDone.wait(lock, [this]() { return m_ActiveWorkers == 0; });
+    m_Task = nullptr;
+}
+
+void CWorkerPool::RunChunks()
+{
+    // Threads claim chunks dynamically; which thread runs a chunk does not
+    // affect its result because chunks never share output
+    for (;;)
+    {
+        size_t chunk = m_NextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= m_ChunkCount)
+        {
+            break;
+        }
+
+        size_t begin = chunk * m_GrainSize;
+        size_t end = std::min(m_Count, begin + m_GrainSize);
+        (*m_Task)(begin, end);
+    }
+}
+
+void CWorkerPool::WorkerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WorkAvailable.wait(lock, [this, seenGeneration]() {
+                return m_Stopping || m_JobGeneration != seenGeneration;
+            });
+
+            if (m_Stopping)
+            {
+                return;
+            }
+            seenGeneration = m_JobGeneration;
+        }
+
+        RunChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_ActiveWorkers--;
+        }
+        m_WorkDone.notify_one();
+    }
+}
+
+size_t CWorkerPool::GetDefaultThreadCount()
+{
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 0 ? static_cast<size_t>(hardwareThreads) : 1;
+}
+
+} // namespace PoliticSim
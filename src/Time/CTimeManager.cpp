@@ -1,4 +1,5 @@
 #include "Time/CTimeManager.h"
+#include <cmath>
 #include <sstream>
 #include <iomanip>
 
@@ -140,6 +141,13 @@ float CTimeManager::ConvertGameToRealTime(float gameSeconds) const
     return 0.0f;
 }
 
+float CTimeManager::GetRealTimeToNextMonth() const
+{
+    float monthSeconds = static_cast<float>(CTimeUnits::SECONDS_PER_MONTH);
+    float gameSeconds = monthSeconds - std::fmod(m_Clock.GetElapsedGameTime(), monthSeconds);
+    return ConvertGameToRealTime(gameSeconds);
+}
+
 float CTimeManager::GetAverageFPS() const
 {
     return m_AverageFPS;
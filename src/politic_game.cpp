@@ -1,10 +1,11 @@
 #include "politic_game.h"
 
 #include <Engine/Core/Camera/CameraManager.h>
+#include <Economy/CCompanyNames.h>
 #include <Economy/ECompanyTypes.h>
 #include <Economy/SCompanyState.h>
 #include <Economy/SCompanyAttributes.h>
-#include <Economy/CCompany.h>
+#include <Economy/SEconomySnapshot.h>
 #include <iostream>
 #include <vector>
 #include <imgui.h>
@@ -41,8 +42,17 @@ bool CPoliticalGame::Initialize() {
 	// Initialize economy manager
 	m_EconomyManager = std::make_unique<CEconomyManager>();
 	m_EconomyManager->Initialize();
+	m_EconomyManager->StartJournal();
+	m_PolicyDraft = m_EconomyManager->GetPolicyParams();
 	std::cout << "Economy Manager initialized" << std::endl;
 
+	// Run the economy on its own thread; the UI only reads snapshots. On a
+	// single core it runs time-sliced ticks on this thread instead.
+	m_Simulation = std::make_unique<CSimulationThread>(*m_EconomyManager);
+	m_Simulation->Start(CWorkerPool::GetDefaultThreadCount() > 1);
+	m_Simulation->AcquireSnapshot();
+	std::cout << "Simulation " << (m_Simulation->IsThreaded() ? "thread started" : "time-sliced on the main thread") << std::endl;
+
 	std::cout << "Political Game initialized successfully!" << std::endl;
 	std::cout << "Controls: WASD to move camera" << std::endl;
 	std::cout << "          SPACE: Pause/Resume" << std::endl;
@@ -191,10 +201,13 @@ void CPoliticalGame::Update(float deltaTime) {
 	// Camera uses real-time for smooth movement
 	HandleContinuousInput(deltaTime);
 
-	// Economy manager uses game time for simulation
-	if (m_EconomyManager)
+	// Economy runs on the simulation thread: hand it the game time and take
+	// the newest published snapshot for this frame's UI
+	if (m_Simulation)
 	{
-		m_EconomyManager->Update(gameDelta);
+		m_Simulation->AdvanceTime(gameDelta);
+		m_Simulation->Pump();
+		m_Simulation->AcquireSnapshot();
 	}
 
 	// World uses game time for simulation
@@ -241,6 +254,12 @@ void CPoliticalGame::Render(CRenderer& renderer) {
 		// Display current time
 		const SGameTime& gameTime = m_TimeManager->GetCurrentTime();
 		ImGui::Text("Current Date: Year %d, Month %d", gameTime.years + 1, gameTime.months + 1);
+		if (m_Simulation)
+		{
+			const SEconomySnapshot& snapshot = m_Simulation->GetSnapshot();
+			ImGui::Text("Economy: month %u, lag %d months", snapshot.m_Tick, snapshot.m_PendingMonths);
+			ImGui::Text("Next month in %.1f s", m_TimeManager->GetRealTimeToNextMonth());
+		}
 
 		ImGui::Separator();
 
@@ -325,171 +344,294 @@ void CPoliticalGame::Render(CRenderer& renderer) {
 		ImGui::End();
 	}
 
-	// Policy Parameters UI
-	if (m_EconomyManager)
+	// Policy Parameters UI (edits a draft; changes are sent to the
+	// simulation thread and take effect at the next tick boundary)
+	if (m_Simulation)
 	{
 		ImGui::Begin("Policy Parameters");
 
-		SPolicyParams& policy = m_EconomyManager->GetPolicyParams();
+		SPolicyParams& policy = m_PolicyDraft;
+		bool policyChanged = false;
 
 		ImGui::Text("Tax Policy");
-		ImGui::SliderFloat("Corporate Tax Rate", &policy.m_CorporateTaxRate, 0.0f, 50.0f, "%.1f%%");
-		ImGui::SliderFloat("Labor Tax Rate", &policy.m_LaborTaxRate, 0.0f, 30.0f, "%.1f%%");
+		policyChanged |= ImGui::SliderFloat("Corporate Tax Rate", &policy.m_CorporateTaxRate, 0.0f, 50.0f, "%.1f%%");
+		policyChanged |= ImGui::SliderFloat("Labor Tax Rate", &policy.m_LaborTaxRate, 0.0f, 30.0f, "%.1f%%");
 
 		ImGui::Separator();
 
 		ImGui::Text("Labor Regulations");
-		ImGui::SliderFloat("Minimum Wage", &policy.m_MinimumWage, 0.0f, 30.0f, "$%.2f/hr");
-		ImGui::SliderFloat("Labor Regulation Burden", &policy.m_LaborRegulationBurden, 0.0f, 1.0f, "%.2f");
+		policyChanged |= ImGui::SliderFloat("Minimum Wage", &policy.m_MinimumWage, 0.0f, 30.0f, "$%.2f/hr");
+		policyChanged |= ImGui::SliderFloat("Labor Regulation Burden", &policy.m_LaborRegulationBurden, 0.0f, 1.0f, "%.2f");
 
 		ImGui::Separator();
 
 		ImGui::Text("Environmental Policy");
-		ImGui::SliderFloat("Environmental Compliance Cost", &policy.m_EnvironmentalComplianceCost, 0.0f, 1.0f, "%.2f");
-		ImGui::Checkbox("Strict Environmental Policy", &policy.m_StrictEnvironmentalPolicy);
+		policyChanged |= ImGui::SliderFloat("Environmental Compliance Cost", &policy.m_EnvironmentalComplianceCost, 0.0f, 1.0f, "%.2f");
+		policyChanged |= ImGui::Checkbox("Strict Environmental Policy", &policy.m_StrictEnvironmentalPolicy);
 
 		ImGui::Separator();
 
 		ImGui::Text("Business Support");
-		ImGui::Checkbox("Enable Subsidies", &policy.m_SubsidiesEnabled);
+		policyChanged |= ImGui::Checkbox("Enable Subsidies", &policy.m_SubsidiesEnabled);
 		if (policy.m_SubsidiesEnabled)
 		{
-			ImGui::SliderFloat("Subsidy Rate", &policy.m_SubsidyRate, 0.0f, 10.0f, "%.1f%%");
+			policyChanged |= ImGui::SliderFloat("Subsidy Rate", &policy.m_SubsidyRate, 0.0f, 10.0f, "%.1f%%");
 		}
 
 		ImGui::Separator();
 
 		ImGui::Text("Trade Policy");
-		ImGui::SliderFloat("Tariff Rate", &policy.m_TariffRate, 0.0f, 50.0f, "%.1f%%");
+		policyChanged |= ImGui::SliderFloat("Tariff Rate", &policy.m_TariffRate, 0.0f, 50.0f, "%.1f%%");
+
+		ImGui::Separator();
+
+		// What-if: a fork of the economy runs ahead on a background thread
+		// with the draft policy; the live economy keeps its policy until Apply
+		ImGui::Text("What-If Projection");
+		const SEconomySnapshot& snapshot = m_Simulation->GetSnapshot();
+		bool previewChanged = ImGui::Checkbox("Preview Only", &m_PreviewPolicy);
+		bool monthsChanged = ImGui::SliderInt("Months Ahead", &m_ProjectionMonths, 6, 120);
+
+		if (previewChanged && !m_PreviewPolicy)
+		{
+			// Leaving preview drops the unapplied draft
+			m_PolicyDraft = snapshot.m_PolicyParams;
+		}
+		else if (m_PreviewPolicy)
+		{
+			if (policyChanged || previewChanged || monthsChanged)
+			{
+				m_Simulation->Project(m_PolicyDraft, m_ProjectionMonths);
+			}
+			if (ImGui::Button("Apply Policy"))
+			{
+				m_Simulation->SetPolicy(m_PolicyDraft);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Reproject"))
+			{
+				m_Simulation->Project(m_PolicyDraft, m_ProjectionMonths);
+			}
+
+			const SProjectionSeries& projection = snapshot.m_Projection;
+			int32_t projectedMonths = static_cast<int32_t>(projection.GetMonthCount());
+			if (projection.m_Generation > 0 && projectedMonths > 0)
+			{
+				ImGui::Text("From month %u, %d months ahead", projection.m_StartTick, projectedMonths);
+
+				ImGui::Text("GDP: $%.1fK -> $%.1fK", snapshot.m_TotalGDP, projection.m_GDP.back());
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.8f, 0.8f, 1.0f));
+				ImGui::PlotLines("##ProjectedGDP", projection.m_GDP.data(), projectedMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
+
+				ImGui::Text("Unemployment: %.2f%% -> %.2f%%", snapshot.m_MacroState.m_UnemploymentRate, projection.m_UnemploymentRate.back());
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.4f, 0.4f, 1.0f));
+				ImGui::PlotLines("##ProjectedUnemployment", projection.m_UnemploymentRate.data(), projectedMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
+			}
+			else
+			{
+				ImGui::TextDisabled("Projecting...");
+			}
+		}
+
+		if (policyChanged && !m_PreviewPolicy)
+		{
+			m_Simulation->SetPolicy(m_PolicyDraft);
+		}
 
 		ImGui::End();
 	}
 
 	// Company Data UI
-	if (m_EconomyManager)
+	if (m_Simulation)
 	{
 		ImGui::Begin("Company Data");
 
 		// Aggregates
-		const SMacroState& macro = m_EconomyManager->GetMacroState();
+		const SEconomySnapshot& snapshot = m_Simulation->GetSnapshot();
+		const SMacroState& macro = snapshot.m_MacroState;
 
 		ImGui::Text("Economy Overview");
 		ImGui::Separator();
-		ImGui::Text("Total Companies: %zu", m_EconomyManager->GetCompanyCount());
-		ImGui::Text("Total Employment: %.0f", m_EconomyManager->GetTotalEmployment());
-		ImGui::Text("Total GDP: $%.1fK", m_EconomyManager->GetTotalGDP());
-		ImGui::Text("Average Profitability: $%.2fK", m_EconomyManager->GetAverageProfitability());
-		ImGui::Text("Unemployment Rate: %.1f%%", m_EconomyManager->GetUnemploymentRate());
+		ImGui::Text("Total Companies: %zu", snapshot.GetCompanyCount());
+		ImGui::Text("Firms Represented: %.0f", snapshot.m_RepresentedCompanies);
+		ImGui::Text("Total Employment: %.0f", snapshot.m_TotalEmployment);
+		ImGui::Text("Total GDP: $%.1fK", snapshot.m_TotalGDP);
+		ImGui::Text("Average Profitability: $%.2fK", snapshot.m_AverageProfitability);
+		ImGui::Text("Unemployment Rate: %.1f%%", macro.m_UnemploymentRate);
 		ImGui::Text("Business Confidence: %.1f", macro.m_BusinessConfidence);
 		ImGui::Text("Aggregate Demand: %.2f", macro.m_AggregateDemand);
 
 		ImGui::Separator();
 		ImGui::Separator();
 
-		// Per-company table (scrollable)
+		// Filters: one checkbox per sector, size and state
+		static const char* const SECTOR_NAMES[] = { "Ag", "Ind", "Svc", "Tech", "Ret" };
+		static const char* const SIZE_NAMES[] = { "Micro", "Small", "Med", "Large" };
+		static const char* const STATE_NAMES[] = { "Grow", "Stable", "Decl", "CRISIS" };
+
+		SCompanyTableQuery query = m_TableQuery;
+		ImGui::PushID("SectorFilter");
+		for (uint32_t sector = 0; sector < static_cast<uint32_t>(ESector::COUNT); ++sector)
+		{
+			if (sector > 0)
+			{
+				ImGui::SameLine();
+			}
+			ImGui::CheckboxFlags(SECTOR_NAMES[sector], &query.m_SectorMask, 1u << sector);
+		}
+		ImGui::PopID();
+		ImGui::PushID("SizeFilter");
+		for (uint32_t size = 0; size < 4; ++size)
+		{
+			if (size > 0)
+			{
+				ImGui::SameLine();
+			}
+			ImGui::CheckboxFlags(SIZE_NAMES[size], &query.m_SizeMask, 1u << size);
+		}
+		ImGui::PopID();
+		ImGui::PushID("StateFilter");
+		for (uint32_t state = 0; state < 4; ++state)
+		{
+			if (state > 0)
+			{
+				ImGui::SameLine();
+			}
+			ImGui::CheckboxFlags(STATE_NAMES[state], &query.m_StateMask, 1u << state);
+		}
+		ImGui::PopID();
+
+		ImGui::Text("Showing %zu of %zu companies", snapshot.m_TableRows.size(), snapshot.GetCompanyCount());
+
+		// Per-company table (scrollable). The simulation thread filters and
+		// sorts the rows when a tick completes; only the visible rows are drawn.
 		static ImGuiTableFlags flags = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg |
 		                                   ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersOuter |
-		                                   ImGuiTableFlags_SizingFixedFit;
+		                                   ImGuiTableFlags_Sortable;
 
 		if (ImGui::BeginTable("Companies", 7, flags, ImVec2(0, 300)))
 		{
+			// Column user IDs are ECompanyTableColumn values
 			ImGui::TableSetupScrollFreeze(0, 1);
-			ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed, 50.0f);
-			ImGui::TableSetupColumn("Sector", ImGuiTableColumnFlags_WidthFixed, 80.0f);
-			ImGui::TableSetupColumn("Size", ImGuiTableColumnFlags_WidthFixed, 60.0f);
-			ImGui::TableSetupColumn("Employees", ImGuiTableColumnFlags_WidthFixed, 70.0f);
-			ImGui::TableSetupColumn("Profit", ImGuiTableColumnFlags_WidthFixed, 70.0f);
-			ImGui::TableSetupColumn("Liquidity", ImGuiTableColumnFlags_WidthFixed, 70.0f);
-			ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+			ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort, 50.0f, static_cast<ImGuiID>(ECompanyTableColumn::ID));
+			ImGui::TableSetupColumn("Sector", ImGuiTableColumnFlags_WidthFixed, 80.0f, static_cast<ImGuiID>(ECompanyTableColumn::Sector));
+			ImGui::TableSetupColumn("Size", ImGuiTableColumnFlags_WidthFixed, 60.0f, static_cast<ImGuiID>(ECompanyTableColumn::Size));
+			ImGui::TableSetupColumn("Employees", ImGuiTableColumnFlags_WidthFixed, 70.0f, static_cast<ImGuiID>(ECompanyTableColumn::Employees));
+			ImGui::TableSetupColumn("Profit", ImGuiTableColumnFlags_WidthFixed, 70.0f, static_cast<ImGuiID>(ECompanyTableColumn::Profit));
+			ImGui::TableSetupColumn("Liquidity", ImGuiTableColumnFlags_WidthFixed, 70.0f, static_cast<ImGuiID>(ECompanyTableColumn::Liquidity));
+			ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 70.0f, static_cast<ImGuiID>(ECompanyTableColumn::State));
 			ImGui::TableHeadersRow();
 
-			const auto& companies = m_EconomyManager->GetCompanies();
-			for (const auto& company : companies)
+			ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+			if (sortSpecs != nullptr && sortSpecs->SpecsDirty && sortSpecs->SpecsCount > 0)
 			{
-				const SCompanyState& state = company->GetState();
-				const SCompanyAttributes& attrs = company->GetAttributes();
-
-				ImGui::TableNextRow();
-				ImGui::TableNextColumn();
-
-				// Selectable row with highlight for selected company
-				bool isSelected = (static_cast<int32_t>(company->GetID()) == m_SelectedCompanyID);
-				if (isSelected)
-				{
-					ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.2f, 0.8f, 0.2f, 1.0f));
-				}
-
-				std::string selectableLabel = "##" + std::to_string(company->GetID());
-				if (ImGui::Selectable(selectableLabel.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap))
-				{
-					m_SelectedCompanyID = company->GetID();
-				}
-
-				if (isSelected)
-				{
-					ImGui::PopStyleColor();
-				}
-
-				// Display ID in the same column
-				ImGui::SameLine(0, 0);
-				ImGui::Text("%u", company->GetID());
-
-				ImGui::TableNextColumn();
-				const char* sector = nullptr;
-				switch (attrs.m_Sector)
-				{
-					case ESector::Agriculture: sector = "Ag"; break;
-					case ESector::Industry: sector = "Ind"; break;
-					case ESector::Services: sector = "Svc"; break;
-					case ESector::Technology: sector = "Tech"; break;
-					case ESector::Retail: sector = "Ret"; break;
-				}
-				ImGui::Text("%s", sector);
-
-				ImGui::TableNextColumn();
-				const char* size = nullptr;
-				switch (attrs.m_Size)
-				{
-					case ECompanySize::Micro: size = "Micro"; break;
-					case ECompanySize::Small: size = "Small"; break;
-					case ECompanySize::Medium: size = "Med"; break;
-					case ECompanySize::Large: size = "Large"; break;
-				}
-				ImGui::Text("%s", size);
-
-				ImGui::TableNextColumn();
-				ImGui::Text("%d", state.m_Employees);
-
-				ImGui::TableNextColumn();
-				ImGui::Text("$%.1fK", state.m_Profitability);
-
-				ImGui::TableNextColumn();
-				ImGui::Text("$%.0fK", state.m_Liquidity);
+				query.m_SortColumn = static_cast<ECompanyTableColumn>(sortSpecs->Specs[0].ColumnUserID);
+				query.m_Descending = sortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Descending;
+				sortSpecs->SpecsDirty = false;
+			}
 
-				ImGui::TableNextColumn();
-				const char* stateStr = nullptr;
-				switch (state.m_State)
+			ImGuiListClipper clipper;
+			clipper.Begin(static_cast<int>(snapshot.m_TableRows.size()));
+			while (clipper.Step())
+			{
+				for (int tableRow = clipper.DisplayStart; tableRow < clipper.DisplayEnd; ++tableRow)
 				{
-					case ECompanyState::Growing: stateStr = "Grow"; break;
-					case ECompanyState::Stable: stateStr = "Stable"; break;
-					case ECompanyState::Declining: stateStr = "Decl"; break;
-					case ECompanyState::Crisis: stateStr = "CRISIS"; break;
+					size_t companyIndex = snapshot.m_TableRows[tableRow];
+					uint32_t companyID = snapshot.m_IDs[companyIndex];
+
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+
+					// Selectable row with highlight for selected company
+					bool isSelected = (static_cast<int32_t>(companyID) == m_SelectedCompanyID);
+					if (isSelected)
+					{
+						ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.2f, 0.8f, 0.2f, 1.0f));
+					}
+
+					// The ID scopes the row's widgets, so no label string is built
+					ImGui::PushID(static_cast<int>(companyID));
+					if (ImGui::Selectable("##row", isSelected, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap))
+					{
+						m_SelectedCompanyID = companyID;
+						m_Simulation->SelectCompany(m_SelectedCompanyID);
+					}
+					ImGui::PopID();
+
+					if (isSelected)
+					{
+						ImGui::PopStyleColor();
+					}
+
+					// Display ID in the same column
+					ImGui::SameLine(0, 0);
+					ImGui::Text("%u", companyID);
+
+					ImGui::TableNextColumn();
+					const char* sector = nullptr;
+					switch (snapshot.m_Sectors[companyIndex])
+					{
+						case ESector::Agriculture: sector = "Ag"; break;
+						case ESector::Industry: sector = "Ind"; break;
+						case ESector::Services: sector = "Svc"; break;
+						case ESector::Technology: sector = "Tech"; break;
+						case ESector::Retail: sector = "Ret"; break;
+					}
+					ImGui::Text("%s", sector);
+
+					ImGui::TableNextColumn();
+					const char* size = nullptr;
+					switch (snapshot.m_Sizes[companyIndex])
+					{
+						case ECompanySize::Micro: size = "Micro"; break;
+						case ECompanySize::Small: size = "Small"; break;
+						case ECompanySize::Medium: size = "Med"; break;
+						case ECompanySize::Large: size = "Large"; break;
+					}
+					ImGui::Text("%s", size);
+
+					ImGui::TableNextColumn();
+					ImGui::Text("%d", snapshot.m_Employees[companyIndex]);
+
+					ImGui::TableNextColumn();
+					ImGui::Text("$%.1fK", snapshot.m_Profitability[companyIndex]);
+
+					ImGui::TableNextColumn();
+					ImGui::Text("$%.0fK", snapshot.m_Liquidity[companyIndex]);
+
+					ImGui::TableNextColumn();
+					const char* stateStr = nullptr;
+					switch (snapshot.m_States[companyIndex])
+					{
+						case ECompanyState::Growing: stateStr = "Grow"; break;
+						case ECompanyState::Stable: stateStr = "Stable"; break;
+						case ECompanyState::Declining: stateStr = "Decl"; break;
+						case ECompanyState::Crisis: stateStr = "CRISIS"; break;
+					}
+					ImGui::Text("%s", stateStr);
 				}
-				ImGui::Text("%s", stateStr);
 			}
 
 			ImGui::EndTable();
 		}
 
+		if (!(query == m_TableQuery))
+		{
+			m_TableQuery = query;
+			m_Simulation->QueryTable(m_TableQuery);
+		}
+
 		ImGui::End();
 	}
 
 	// Market Saturation Window
-	if (m_EconomyManager)
+	if (m_Simulation)
 	{
 		ImGui::Begin("Market Saturation");
 
-		const SMacroState& macro = m_EconomyManager->GetMacroState();
+		const SMacroState& macro = m_Simulation->GetSnapshot().m_MacroState;
 
 		ImGui::Text("Sector Saturation (higher = more competitive):");
 		ImGui::Separator();
@@ -519,30 +661,24 @@ void CPoliticalGame::Render(CRenderer& renderer) {
 	}
 
 	// Company History Graph Window
-	if (m_EconomyManager && m_SelectedCompanyID >= 0)
+	if (m_Simulation && m_SelectedCompanyID >= 0)
 	{
-		const CCompany* selectedCompany = nullptr;
-		const auto& companies = m_EconomyManager->GetCompanies();
+		// The snapshot carries the selected company's detail once the
+		// simulation thread has seen the selection
+		const SEconomySnapshot& snapshot = m_Simulation->GetSnapshot();
 
-		// Find the selected company
-		for (const auto& company : companies)
-		{
-			if (static_cast<int32_t>(company->GetID()) == m_SelectedCompanyID)
-			{
-				selectedCompany = company.get();
-				break;
-			}
-		}
-
-		if (selectedCompany)
+		if (snapshot.m_SelectedID == m_SelectedCompanyID && snapshot.m_SelectedFound)
 		{
 			ImGui::Begin("Company History");
 
-			const SCompanyState& state = selectedCompany->GetState();
-			const SCompanyAttributes& attrs = selectedCompany->GetAttributes();
+			const SCompanyState& state = snapshot.m_SelectedState;
+			const SCompanyAttributes& attrs = snapshot.m_SelectedAttributes;
 
 			// Company info header
-			ImGui::Text("Company ID: %u", selectedCompany->GetID());
+			char name[CCompanyNames::MAX_LENGTH];
+			CCompanyNames::Format(static_cast<uint32_t>(snapshot.m_SelectedID), attrs.m_Sector, name, sizeof(name));
+			ImGui::Text("%s", name);
+			ImGui::Text("Company ID: %d", snapshot.m_SelectedID);
 			ImGui::SameLine();
 			ImGui::Text("Sector: ");
 			switch (attrs.m_Sector)
@@ -571,55 +707,49 @@ void CPoliticalGame::Render(CRenderer& renderer) {
 			ImGui::Text("Revenue: $%.1fK", state.m_LastRevenue);
 
 			ImGui::Separator();
-			ImGui::Text("History (last 24 months):");
-
-			// Get history data
-			int32_t historyMonths = selectedCompany->GetHistoryMonths();
-			int32_t historyIndex = selectedCompany->GetHistoryIndex();
-
-			const float* profitHistory = selectedCompany->GetProfitHistory();
-			const float* employeesHistory = selectedCompany->GetEmployeesHistory();
-			const float* liquidityHistory = selectedCompany->GetLiquidityHistory();
-			const float* revenueHistory = selectedCompany->GetRevenueHistory();
-
-			// Prepare data arrays for ImGui (reorder from oldest to newest)
-			std::vector<float> profitValues(historyMonths);
-			std::vector<float> employeesValues(historyMonths);
-			std::vector<float> liquidityValues(historyMonths);
-			std::vector<float> revenueValues(historyMonths);
+			// Get history data (oldest to newest)
+			int32_t historyMonths = snapshot.m_HistoryMonths;
+			ImGui::Text("History (last %d months):", historyMonths);
 
-			for (int32_t i = 0; i < historyMonths; ++i)
+			// Plot Profit History (Green)
+			if (snapshot.m_HistoryRecorded[static_cast<int32_t>(EHistoryMetric::Profit)])
 			{
-				int32_t idx = (historyIndex + i) % historyMonths;
-				profitValues[i] = profitHistory[idx];
-				employeesValues[i] = employeesHistory[idx];
-				liquidityValues[i] = liquidityHistory[idx];
-				revenueValues[i] = revenueHistory[idx];
+				const float* historyValues = snapshot.m_History[static_cast<int32_t>(EHistoryMetric::Profit)].data();
+				ImGui::Text("Profit (K):");
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.8f, 0.0f, 1.0f));
+				ImGui::PlotLines("##Profit", historyValues, historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
 			}
 
-			// Plot Profit History (Green)
-			ImGui::Text("Profit (K):");
-			ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.8f, 0.0f, 1.0f));
-			ImGui::PlotLines("##Profit", profitValues.data(), historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
-			ImGui::PopStyleColor();
-
 			// Plot Employees History (Blue)
-			ImGui::Text("Employees:");
-			ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.4f, 1.0f, 1.0f));
-			ImGui::PlotLines("##Employees", employeesValues.data(), historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
-			ImGui::PopStyleColor();
+			if (snapshot.m_HistoryRecorded[static_cast<int32_t>(EHistoryMetric::Employees)])
+			{
+				const float* historyValues = snapshot.m_History[static_cast<int32_t>(EHistoryMetric::Employees)].data();
+				ImGui::Text("Employees:");
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.4f, 1.0f, 1.0f));
+				ImGui::PlotLines("##Employees", historyValues, historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
+			}
 
 			// Plot Liquidity History (Yellow)
-			ImGui::Text("Liquidity (K):");
-			ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.8f, 0.0f, 1.0f));
-			ImGui::PlotLines("##Liquidity", liquidityValues.data(), historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
-			ImGui::PopStyleColor();
+			if (snapshot.m_HistoryRecorded[static_cast<int32_t>(EHistoryMetric::Liquidity)])
+			{
+				const float* historyValues = snapshot.m_History[static_cast<int32_t>(EHistoryMetric::Liquidity)].data();
+				ImGui::Text("Liquidity (K):");
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.8f, 0.0f, 1.0f));
+				ImGui::PlotLines("##Liquidity", historyValues, historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
+			}
 
 			// Plot Revenue History (Cyan)
-			ImGui::Text("Revenue (K):");
-			ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.8f, 0.8f, 1.0f));
-			ImGui::PlotLines("##Revenue", revenueValues.data(), historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
-			ImGui::PopStyleColor();
+			if (snapshot.m_HistoryRecorded[static_cast<int32_t>(EHistoryMetric::Revenue)])
+			{
+				const float* historyValues = snapshot.m_History[static_cast<int32_t>(EHistoryMetric::Revenue)].data();
+				ImGui::Text("Revenue (K):");
+				ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 0.8f, 0.8f, 1.0f));
+				ImGui::PlotLines("##Revenue", historyValues, historyMonths, 0, nullptr, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+				ImGui::PopStyleColor();
+			}
 
 			ImGui::End();
 		}
@@ -636,9 +766,20 @@ void CPoliticalGame::Render(CRenderer& renderer) {
 void CPoliticalGame::Cleanup() {
 	std::cout << "Cleaning up Political Game..." << std::endl;
 
+	// Stop the simulation thread before the economy it runs goes away
+	if (m_Simulation)
+	{
+		m_Simulation->Stop();
+		m_Simulation.reset();
+	}
+
 	// Shutdown economy manager
 	if (m_EconomyManager)
 	{
+		if (m_EconomyManager->GetJournal().Save(SESSION_JOURNAL_PATH))
+		{
+			std::cout << "Session journal written to " << SESSION_JOURNAL_PATH << std::endl;
+		}
 		m_EconomyManager->Shutdown();
 		m_EconomyManager.reset();
 	}